@@ -0,0 +1,309 @@
+#!/usr/bin/env python
+"""Whole-simulation performance regression harness for EnergyPlus.
+
+Runs a subset of the testfiles input files through an energyplus executable
+with the PERFORMANCE_LOG environment variable set, and collects the
+eplusout.perflog written at the end of each run: the time spent in each
+simulation phase (get_input, sizing, warmup, run_period, reporting), the peak
+memory use and the HVAC iteration counts.  Two such reports, e.g. from the
+develop branch and a pull request, are then compared with noise handling.
+
+  performance_regression.py run --energyplus build/Products/energyplus \\
+      --repeat 5 --output develop.json
+  performance_regression.py compare develop.json branch.json
+
+The run subcommand takes the weather file and the design day or annual
+setting of each input file from the ADD_SIMULATION_TEST lines in
+testfiles/CMakeLists.txt, so the cases match the integration tests.
+"""
+
+# python 2/3 compatibility imports
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+# standard library imports
+import argparse
+import datetime
+import json
+import math
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+SOURCE_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_SUBSET = os.path.join(SOURCE_DIR, 'scripts', 'performance_subset.txt')
+
+PHASES = ['get_input', 'sizing', 'warmup', 'run_period', 'reporting']
+
+# (metric, unit) pairs compared by the compare subcommand; the iteration
+# counts are deterministic, so any change in them beyond the threshold is
+# reported even though it has no timing noise
+METRICS = [('wall_time', 's'), ('elapsed_time', 's')] + \
+          [('phases.%s.elapsed_time' % phase, 's') for phase in PHASES] + \
+          [('peak_memory', 'kB'), ('zone_time_steps', ''), ('hvac_iterations', ''),
+           ('hvac_max_iterations', '')]
+
+
+def read_simulation_tests(cmake_file):
+    """Returns {idf name: (idf file, epw file, energyplus flags)} from ADD_SIMULATION_TEST lines."""
+    tests = {}
+    pattern = re.compile(r'^\s*ADD_SIMULATION_TEST\((.*)\)')
+    with open(cmake_file) as f:
+        for line in f:
+            match = pattern.match(line)
+            if not match:
+                continue
+            args = match.group(1).split()
+            idf_file = epw_file = None
+            flags = []
+            annual = False
+            design_day_only = False
+            i = 0
+            while i < len(args):
+                if args[i] == 'IDF_FILE':
+                    idf_file = args[i + 1]
+                    i += 1
+                elif args[i] == 'EPW_FILE':
+                    epw_file = args[i + 1]
+                    i += 1
+                elif args[i] == 'COST':
+                    i += 1
+                elif args[i] == 'ENERGYPLUS_FLAGS':
+                    while i + 1 < len(args) and args[i + 1].startswith('-'):
+                        flags.append(args[i + 1])
+                        i += 1
+                elif args[i] == 'ANNUAL_SIMULATION':
+                    annual = True
+                elif args[i] == 'DESIGN_DAY_ONLY':
+                    design_day_only = True
+                i += 1
+            if idf_file is None:
+                continue
+            flags.append('-a' if annual and not design_day_only else '-D')
+            tests[os.path.splitext(idf_file)[0]] = (idf_file, epw_file, flags)
+    return tests
+
+
+def read_subset(names):
+    """Expands the subset arguments, which are input file names or files listing them."""
+    cases = []
+    for name in names:
+        if os.path.isfile(name):
+            with open(name) as f:
+                for line in f:
+                    line = line.split('#')[0].strip()
+                    if line:
+                        cases.append(line)
+        else:
+            cases.append(name)
+    return [os.path.splitext(os.path.basename(case))[0] for case in cases]
+
+
+def run_case(args, name, test, run_dir):
+    """Runs one simulation and returns its performance log with the measured wall time added."""
+    idf_file, epw_file, flags = test
+    if os.path.isdir(run_dir):
+        shutil.rmtree(run_dir)
+    os.makedirs(run_dir)
+    command = [args.energyplus, '-d', run_dir] + flags
+    if args.idd:
+        command += ['-i', args.idd]
+    if epw_file:
+        command += ['-w', os.path.join(args.weather_dir, epw_file)]
+    command.append(os.path.join(args.testfiles_dir, idf_file))
+    env = dict(os.environ)
+    env['PERFORMANCE_LOG'] = 'Yes'
+    with open(os.path.join(run_dir, 'performance_regression.log'), 'w') as log:
+        start = time.time()
+        status = subprocess.call(command, cwd=run_dir, env=env, stdout=log, stderr=subprocess.STDOUT)
+        wall_time = time.time() - start
+    perf_log_file = os.path.join(run_dir, 'eplusout.perflog')
+    if not os.path.isfile(perf_log_file):
+        print('  %s: no performance log written (exit status %d)' % (name, status))
+        return None
+    with open(perf_log_file) as f:
+        result = json.load(f)
+    result['wall_time'] = wall_time
+    result['exit_status'] = status
+    return result
+
+
+def command_run(args):
+    tests = read_simulation_tests(os.path.join(args.testfiles_dir, 'CMakeLists.txt'))
+    cases = read_subset(args.subset or [DEFAULT_SUBSET])
+    if not cases:
+        print('No input files to run')
+        return 1
+    # Check all the cases before spending time on any simulation
+    missing = []
+    for name in cases:
+        if name not in tests:
+            missing.append('%s: no ADD_SIMULATION_TEST in %s' % (name, os.path.join(args.testfiles_dir, 'CMakeLists.txt')))
+        elif not os.path.isfile(os.path.join(args.testfiles_dir, tests[name][0])):
+            missing.append('%s: input file %s does not exist' % (name, os.path.join(args.testfiles_dir, tests[name][0])))
+    if missing:
+        for message in missing:
+            print(message)
+        return 1
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix='eplus_perf_')
+    report = {
+        'context': {
+            'date': datetime.datetime.now().strftime('%Y-%m-%dT%H:%M:%S'),
+            'energyplus': args.energyplus,
+            'host': platform.node(),
+            'platform': platform.platform(),
+            'repeat': args.repeat,
+        },
+        'cases': {}
+    }
+    failed = False
+    for name in cases:
+        runs = []
+        for repetition in range(args.repeat):
+            result = run_case(args, name, tests[name], os.path.join(work_dir, name))
+            if result is None or not result.get('completed', False):
+                failed = True
+                break
+            runs.append(result)
+            print('  %s [%d/%d]: %.2f s, %d kB' % (name, repetition + 1, args.repeat, result['wall_time'],
+                                                  result['peak_memory']))
+        if runs:
+            idf_file, epw_file, flags = tests[name]
+            report['cases'][name] = {'idf_file': idf_file, 'epw_file': epw_file, 'flags': flags, 'runs': runs}
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+    print('Wrote %s' % args.output)
+    if not args.work_dir:
+        shutil.rmtree(work_dir, ignore_errors=True)
+    return 1 if failed else 0
+
+
+def metric_values(runs, metric):
+    values = []
+    for run in runs:
+        value = run
+        for key in metric.split('.'):
+            value = value.get(key) if isinstance(value, dict) else None
+        if isinstance(value, (int, float)):
+            values.append(float(value))
+    return values
+
+
+def median(values):
+    ordered = sorted(values)
+    m = len(ordered) // 2
+    return ordered[m] if len(ordered) % 2 == 1 else 0.5 * (ordered[m - 1] + ordered[m])
+
+
+def relative_noise(values):
+    """Relative spread of the samples, the scaled median absolute deviation over the median."""
+    center = median(values)
+    if len(values) < 2 or center == 0.0:
+        return 0.0
+    return 1.4826 * median([abs(value - center) for value in values]) / abs(center)
+
+
+def compare_metric(base_values, new_values, threshold, min_value):
+    """Returns (base median, new median, relative change, noise, status) of one metric."""
+    base = median(base_values)
+    new = median(new_values)
+    if base == new:
+        return base, new, 0.0, 0.0, ''
+    change = (new - base) / base if base != 0.0 else float('inf')
+    noise = max(relative_noise(base_values), relative_noise(new_values))
+    # A change is only significant if it is beyond both the threshold and three
+    # times the run to run noise, and the two sets of samples do not overlap
+    significant = abs(change) > max(threshold, 3.0 * noise) and max(base, new) >= min_value
+    if significant and len(base_values) > 1 and len(new_values) > 1:
+        significant = min(new_values) > max(base_values) or max(new_values) < min(base_values)
+    if not significant:
+        return base, new, change, noise, ''
+    return base, new, change, noise, 'REGRESSION' if change > 0.0 else 'improvement'
+
+
+def command_compare(args):
+    with open(args.base) as f:
+        base_report = json.load(f)
+    with open(args.new) as f:
+        new_report = json.load(f)
+    base_cases = base_report['cases']
+    new_cases = new_report['cases']
+    regressions = 0
+    log_ratios = []
+    print('%-40s %-32s %12s %12s %9s %7s' % ('case', 'metric', 'base', 'new', 'change', 'noise'))
+    for name in sorted(set(base_cases) | set(new_cases)):
+        if name not in base_cases or name not in new_cases:
+            print('%-40s only in %s' % (name, args.base if name in base_cases else args.new))
+            continue
+        for metric, unit in METRICS:
+            base_values = metric_values(base_cases[name]['runs'], metric)
+            new_values = metric_values(new_cases[name]['runs'], metric)
+            if not base_values or not new_values:
+                continue
+            # Phase times shorter than min_time are mostly noise
+            min_value = args.min_time if unit == 's' else 0.0
+            base, new, change, noise, status = compare_metric(base_values, new_values, args.threshold, min_value)
+            if metric == 'elapsed_time' and base > 0.0 and new > 0.0:
+                log_ratios.append(math.log(new / base))
+            if status == 'REGRESSION':
+                regressions += 1
+            if status or args.verbose:
+                print('%-40s %-32s %12.4g %12.4g %+8.1f%% %6.1f%% %s' % (name, metric + (' {%s}' % unit if unit else ''),
+                                                                        base, new, 100.0 * change, 100.0 * noise, status))
+    if log_ratios:
+        geomean = math.exp(sum(log_ratios) / len(log_ratios))
+        print('Geometric mean of the simulation time ratios over %d cases: %.3f (%+.1f%%)' %
+              (len(log_ratios), geomean, 100.0 * (geomean - 1.0)))
+    print('%d significant regression(s)' % regressions)
+    return 1 if regressions > 0 else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='EnergyPlus whole-simulation performance regression harness')
+    subparsers = parser.add_subparsers(dest='command')
+
+    run_parser = subparsers.add_parser('run', help='run the simulations and write a performance report')
+    run_parser.add_argument('--energyplus', required=True, help='path of the energyplus executable')
+    run_parser.add_argument('--idd', help='path of Energy+.idd (default: next to the executable)')
+    run_parser.add_argument('--testfiles-dir', default=os.path.join(SOURCE_DIR, 'testfiles'))
+    run_parser.add_argument('--weather-dir', default=os.path.join(SOURCE_DIR, 'weather'))
+    run_parser.add_argument('--subset', nargs='+',
+                            help='input file names, or files listing them (default: %s)' % DEFAULT_SUBSET)
+    run_parser.add_argument('--repeat', type=int, default=3, help='runs of each input file (default: 3)')
+    run_parser.add_argument('--work-dir', help='keep the run directories here (default: a temporary directory)')
+    run_parser.add_argument('--output', default='performance.json', help='report file (default: performance.json)')
+
+    compare_parser = subparsers.add_parser('compare', help='compare two performance reports')
+    compare_parser.add_argument('base', help='report of the reference build')
+    compare_parser.add_argument('new', help='report of the build being tested')
+    compare_parser.add_argument('--threshold', type=float, default=0.05,
+                                help='smallest relative change reported (default: 0.05)')
+    compare_parser.add_argument('--min-time', type=float, default=0.5,
+                                help='times below this many seconds are not reported (default: 0.5)')
+    compare_parser.add_argument('--verbose', action='store_true', help='print all metrics')
+
+    args = parser.parse_args()
+    if args.command == 'run':
+        # The simulations run in their own directories
+        args.energyplus = os.path.abspath(args.energyplus)
+        args.testfiles_dir = os.path.abspath(args.testfiles_dir)
+        args.weather_dir = os.path.abspath(args.weather_dir)
+        if args.idd:
+            args.idd = os.path.abspath(args.idd)
+        if args.work_dir:
+            args.work_dir = os.path.abspath(args.work_dir)
+        return command_run(args)
+    elif args.command == 'compare':
+        return command_compare(args)
+    parser.print_help()
+    return 2
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -297,6 +297,7 @@ ProcessArgs(int argc, const char * argv[])
 	outputDxfFileName = outputFilePrefix + normalSuffix + ".dxf";
 	outputEioFileName = outputFilePrefix + normalSuffix + ".eio";
 	outputEndFileName = outputFilePrefix + normalSuffix + ".end";
+	outputPerfLogFileName = outputFilePrefix + normalSuffix + ".perflog";
 	outputErrFileName = outputFilePrefix + normalSuffix + ".err";
 	outputEsoFileName = outputFilePrefix + normalSuffix + ".eso";
 	outputMtdFileName = outputFilePrefix + normalSuffix + ".mtd";
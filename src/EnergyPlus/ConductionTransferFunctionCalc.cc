@@ -253,6 +253,7 @@ namespace ConductionTransferFunctionCalc {
 		Array1D_bool ResLayer( MaxLayersInConstruct ); // Set true if the layer must be handled as a resistive
 		bool RevConst; // Set true if one construct is the reverse of another (CTFs already
 		// available)
+		bool SameConst; // Set true if one construct has the same layers as another
 		Array1D< Real64 > rho( MaxLayersInConstruct ); // Density of a material layer
 		Array1D< Real64 > rk( MaxLayersInConstruct ); // Thermal conductivity of a material layer
 		Real64 rs; // Total thermal resistance of the building element
@@ -510,27 +511,55 @@ namespace ConductionTransferFunctionCalc {
 					// calculate CTF/QTFs.  So, don't even check for reversed constructions.
 					if ( Construct( ConstrNum ).SourceSinkPresent ) break; // Constr DO loop
 
+					if ( Construct( Constr ).TypeIsWindow ) continue;
+
 					if ( Construct( ConstrNum ).TotLayers == Construct( Constr ).TotLayers ) { // Same number of layers--now | check for reversed construct.
 
 						RevConst = true;
+						SameConst = true;
 
 						for ( Layer = 1; Layer <= Construct( ConstrNum ).TotLayers; ++Layer ) { // Begin layers loop ...
 
-							// RevConst is set to FALSE anytime a mismatch in materials is found.
-							// This will exit this DO immediately and go on to the next construct
-							// (if any remain).
+							// RevConst (SameConst) is set to FALSE anytime a mismatch in materials is found
+							// in reverse (same) order.  Once both are FALSE this will exit this DO immediately
+							// and go on to the next construct (if any remain).
 
 							OppositeLayer = Construct( ConstrNum ).TotLayers - Layer + 1;
 
 							if ( Construct( ConstrNum ).LayerPoint( Layer ) != Construct( Constr ).LayerPoint( OppositeLayer ) ) {
-
 								RevConst = false;
-								break; // Layer DO loop
-
 							}
+							if ( Construct( ConstrNum ).LayerPoint( Layer ) != Construct( Constr ).LayerPoint( Layer ) ) {
+								SameConst = false;
+							}
+							if ( ! RevConst && ! SameConst ) break; // Layer DO loop
 
 						} // ... end of layers loop.
 
+						if ( SameConst && ! RevConst && ! Construct( Constr ).SourceSinkPresent ) { // Current construction has the same layers as
+							// construction Constr (a duplicate under another name).  Thus, CTFs do not
+							// need to be re-calculated.  Copy CTF info for construction Constr to
+							// construction ConstrNum as is.
+
+							Construct( ConstrNum ).CTFTimeStep = Construct( Constr ).CTFTimeStep;
+							Construct( ConstrNum ).NumHistories = Construct( Constr ).NumHistories;
+							Construct( ConstrNum ).NumCTFTerms = Construct( Constr ).NumCTFTerms;
+
+							for ( HistTerm = 0; HistTerm <= Construct( ConstrNum ).NumCTFTerms; ++HistTerm ) {
+
+								Construct( ConstrNum ).CTFInside( HistTerm ) = Construct( Constr ).CTFInside( HistTerm );
+								Construct( ConstrNum ).CTFCross( HistTerm ) = Construct( Constr ).CTFCross( HistTerm );
+								Construct( ConstrNum ).CTFOutside( HistTerm ) = Construct( Constr ).CTFOutside( HistTerm );
+								if ( HistTerm != 0 ) Construct( ConstrNum ).CTFFlux( HistTerm ) = Construct( Constr ).CTFFlux( HistTerm );
+
+							}
+
+							// Flag as already available so the CTFs are not calculated or stored again below.
+							RevConst = true;
+							break; // Constr DO loop
+
+						}
+
 						if ( RevConst ) { // Curent construction is a reverse of
 							// construction Constr.  Thus, CTFs do not need to be re-
 							// calculated.  Copy CTF info for construction Constr to
@@ -3437,6 +3437,7 @@ Label999: ;
 		int M1;
 		Real64 MIDX;
 		Real64 MIDY;
+		static Array1D< Real64 > XLAG; // X interpolated at each Y, only grown when a larger table is seen
 
 		//       INITIALIZE
 		bool QUITX = false;
@@ -3512,7 +3513,7 @@ Label999: ;
 		if ( QUITX && QUITY ) {
 			DLAG = Z( J, I ); // found exact X and Y point in Z array
 		} else if ( QUITX && ! QUITY ) { // only interpolate in Y direction
-			Array1D< Real64 > XLAG( IEYPT );
+			if ( isize( XLAG ) < IEYPT ) XLAG.dimension( IEYPT );
 			for ( int l = ISYPT; l <= IEYPT; ++l ) {
 				XLAG( l ) = Z( l, I ); // store X's at each Y (I = midpoint of array from above)
 			}
@@ -3520,7 +3521,7 @@ Label999: ;
 		} else if ( ! QUITX && QUITY ) { // only interpolate in X direction
 			Interpolate_Lagrange( XX, Z( J, _ ), X, ISXPT, IEXPT, DLAG ); // (:,J) interpolate X array at fixed Y (J here)
 		} else { // else interpolate in X and Y directions
-			Array1D< Real64 > XLAG( IEYPT );
+			if ( isize( XLAG ) < IEYPT ) XLAG.dimension( IEYPT );
 			for ( K = ISYPT; K <= IEYPT; ++K ) {
 				Interpolate_Lagrange( XX, Z( K, _ ), X, ISXPT, IEXPT, XLAG( K ) ); // (:,K) interpolate X array at all Y's (K here)
 			}
@@ -3904,13 +3905,6 @@ Label999: ;
 		int NV5;
 		int TableIndex;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:)     :: ONEDVALS
-		Array2D< Real64 > TWODVALS;
-		Array3D< Real64 > THREEDVALS;
-		Array1D< Real64 > VALSX;
-		Array1D< Real64 > VALSY;
-		Array1D< Real64 > VALSV3;
-		Array1D< Real64 > VALSV4;
-		Array1D< Real64 > VALSV5;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:) :: HPVAL
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:) :: HPVALS
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:,:) :: DVLTRN
@@ -4013,120 +4007,79 @@ Label999: ;
 			V5 = 0.0;
 		}
 
-		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
+		// The independent variable arrays are passed to DLAG directly and the intermediate results are
+		// kept in work space owned by the table, so no arrays are allocated here once the table has been
+		// evaluated the first time.
+		auto & Table( TableLookup( TableIndex ) );
+		{ auto const SELECT_CASE_var( Table.NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
+			NX = Table.NumX1Vars;
 			NY = 1;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			TableValue = DLAG( V1, VALSX( 1 ), VALSX, VALSX, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
+			NUMPT = Table.InterpolationOrder;
+			TableValue = DLAG( V1, Table.X1Var( 1 ), Table.X1Var, Table.X1Var, Table.TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 2 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			TableValue = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
-			VALSY.deallocate();
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NUMPT = Table.InterpolationOrder;
+			TableValue = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 3 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			TWODVALS.allocate( 1, NV3 );
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NUMPT = Table.InterpolationOrder;
+			Array2D< Real64 > & TWODVALS( Table.TwoDVals );
+			TWODVALS.dimension( 1, NV3 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-				TWODVALS( 1, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, 1, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+				TWODVALS( 1, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, 1, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 			}
 			if ( NV3 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V3, 1.0, VALSV3, VALSV3, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
+				TableValue = DLAG( V3, 1.0, Table.X3Var, Table.X3Var, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
 			}
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
 		} else if ( SELECT_CASE_var == 4 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			TWODVALS.allocate( NV4, NV3 );
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NV4 = Table.NumX4Vars;
+			NUMPT = Table.InterpolationOrder;
+			Array2D< Real64 > & TWODVALS( Table.TwoDVals );
+			TWODVALS.dimension( NV4, NV3 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
 				for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-					TWODVALS( IV4, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+					TWODVALS( IV4, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 				}
 			}
 			// final interpolation of 2-D array in V3 and V4
-			TableValue = DLAG( V3, V4, VALSV3, VALSV4, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
+			TableValue = DLAG( V3, V4, Table.X3Var, Table.X4Var, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
 		} else if ( SELECT_CASE_var == 5 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NV5 = TableLookup( TableIndex ).NumX5Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			VALSV5.allocate( NV5 );
-			VALSV5 = TableLookup( TableIndex ).X5Var;
-			THREEDVALS.allocate( NV5, NV4, NV3 );
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NV4 = Table.NumX4Vars;
+			NV5 = Table.NumX5Vars;
+			NUMPT = Table.InterpolationOrder;
+			Array3D< Real64 > & THREEDVALS( Table.ThreeDVals );
+			THREEDVALS.dimension( NV5, NV4, NV3 );
 			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
 				for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
 					for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-						THREEDVALS( IV5, IV4, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( IV5, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+						THREEDVALS( IV5, IV4, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( IV5, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 					}
 				}
 			}
-			TWODVALS.allocate( 1, NV5 );
+			Array2D< Real64 > & TWODVALS( Table.TwoDVals );
+			TWODVALS.dimension( 1, NV5 );
 			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
-				TWODVALS( 1, IV5 ) = DLAG( V3, V4, VALSV3, VALSV4, THREEDVALS( IV5, _, _ ), NV3, NV4, NUMPT, IEXTX, IEXTY );
+				TWODVALS( 1, IV5 ) = DLAG( V3, V4, Table.X3Var, Table.X4Var, THREEDVALS( IV5, _, _ ), NV3, NV4, NUMPT, IEXTX, IEXTY );
 			}
 			if ( NV5 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V5, 1.0, VALSV5, VALSV5, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
-			}
-			TWODVALS.deallocate();
-			THREEDVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
-			VALSV5.deallocate();
+				TableValue = DLAG( V5, 1.0, Table.X5Var, Table.X5Var, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
+			}
 		} else {
 			TableValue = 0.0;
 			ShowSevereError( "Errors found in table output calculation for " + PerfCurve( CurveIndex ).Name );
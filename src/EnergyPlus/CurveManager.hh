@@ -6,6 +6,7 @@
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array2S.hh>
+#include <ObjexxFCL/Array3D.hh>
 #include <ObjexxFCL/Array5D.hh>
 #include <ObjexxFCL/Optional.hh>
 
@@ -45,7 +46,7 @@ namespace CurveManager {
 	extern int const DoubleExponentialDecay;
 	extern int const QuadLinear;
 	extern int const CubicLinear;
-	extern int const ChillerPartLoadCustom;
+	extern int const ChillerPartLoadWithLift;
 
 	// Interpolation Types
 	extern int const LinearInterpolationOfTable;
@@ -85,7 +86,7 @@ namespace CurveManager {
 	extern int const CurveType_DoubleExponentialDecay;
 	extern int const CurveType_QuadLinear;
 	extern int const CurveType_CubicLinear;
-	extern int const CurveType_ChillerPartLoadCustom;
+	extern int const CurveType_ChillerPartLoadWithLift;
 
 	extern Array1D_string const cCurveTypes;
 
@@ -490,6 +491,8 @@ namespace CurveManager {
 		int NumX5Vars; // Number of variables for independent variable #5
 		Array1D< Real64 > X5Var;
 		Array5D< Real64 > TableLookupZData;
+		Array2D< Real64 > TwoDVals; // interpolation work space for tables of 3 or more independent variables
+		Array3D< Real64 > ThreeDVals; // interpolation work space for tables of 5 independent variables
 
 		// Default Constructor
 		TableLookupData() :
@@ -72,6 +72,10 @@ namespace DataConvergParams {
 	int const CalledFromAirSystemDemandSide( 100 );
 	int const CalledFromAirSystemSupplySideDeck1( 101 );
 	int const CalledFromAirSystemSupplySideDeck2( 102 );
+
+	// Parameters for SysTimeStepControl
+	int const SysTimeStepControlTempChange( 1 ); // shorten the system timestep on the zone air temperature change
+	int const SysTimeStepControlTruncationError( 2 ); // shorten the system timestep on the estimated truncation error
 	// DERIVED TYPE DEFINITIONS:
 	// na
 
@@ -83,6 +87,8 @@ namespace DataConvergParams {
 	Real64 MinTimeStepTol( 1.0e-4 ); // = min allowable for ABS(1.-TimeStepSys/(MinTimeStepSys))
 	Real64 MaxZoneTempDiff( 0.3 ); // 0.3 C = (1% OF 300 C) = max allowable difference between
 	//   zone air temp at Time=T and Time=T-1
+	int SysTimeStepControl( SysTimeStepControlTempChange ); // method used to set the number of system timesteps in a zone timestep
+	Real64 MaxZoneTempError( 0.05 ); // max allowable estimated truncation error of zone air temp (TruncationError control)
 	Real64 MinSysTimeRemaining( ( 1.0 / 3600.0 ) ); // = 1 second
 	int MaxIter( 20 ); // maximum number of iterations allowed
 
@@ -69,6 +69,10 @@ namespace DataConvergParams {
 	extern int const CalledFromAirSystemDemandSide;
 	extern int const CalledFromAirSystemSupplySideDeck1;
 	extern int const CalledFromAirSystemSupplySideDeck2;
+
+	// Parameters for SysTimeStepControl
+	extern int const SysTimeStepControlTempChange; // shorten the system timestep on the zone air temperature change
+	extern int const SysTimeStepControlTruncationError; // shorten the system timestep on the estimated truncation error
 	// DERIVED TYPE DEFINITIONS:
 	// na
 
@@ -80,6 +84,8 @@ namespace DataConvergParams {
 	extern Real64 MinTimeStepTol; // = min allowable for ABS(1.-TimeStepSys/(MinTimeStepSys))
 	extern Real64 MaxZoneTempDiff; // 0.3 C = (1% OF 300 C) = max allowable difference between
 	//   zone air temp at Time=T and Time=T-1
+	extern int SysTimeStepControl; // method used to set the number of system timesteps in a zone timestep
+	extern Real64 MaxZoneTempError; // max allowable estimated truncation error of zone air temp (TruncationError control)
 	extern Real64 MinSysTimeRemaining; // = 1 second
 	extern int MaxIter; // maximum number of iterations allowed
 
@@ -3802,6 +3802,14 @@ namespace DataHeatBalance {
 		int NumberOfDevices;
 		int MaxNumberOfDevices;
 		Array1D< GenericComponentZoneIntGainStruct > Device;
+		// Sums over Device of the gain rates held for the timestep (set by UpdateInternalGainValues)
+		Real64 SumConvGainRate; // Convective gain rate
+		Real64 SumReturnAirConvGainRate; // Convective gain rate to return air
+		Real64 SumRadiantGainRate; // Radiant gain rate
+		Real64 SumLatentGainRate; // Latent gain rate
+		Real64 SumReturnAirLatentGainRate; // Latent gain rate to return air
+		Real64 SumCarbonDioxideGainRate; // Carbon dioxide gain rate
+		Real64 SumGenericContamGainRate; // Generic contaminant gain rate
 
 		// Default Constructor
 		ZoneSimData() :
@@ -3839,7 +3847,14 @@ namespace DataHeatBalance {
 			QBBCON( 0.0 ),
 			QBBRAD( 0.0 ),
 			NumberOfDevices( 0 ),
-			MaxNumberOfDevices( 0 )
+			MaxNumberOfDevices( 0 ),
+			SumConvGainRate( 0.0 ),
+			SumReturnAirConvGainRate( 0.0 ),
+			SumRadiantGainRate( 0.0 ),
+			SumLatentGainRate( 0.0 ),
+			SumReturnAirLatentGainRate( 0.0 ),
+			SumCarbonDioxideGainRate( 0.0 ),
+			SumGenericContamGainRate( 0.0 )
 		{}
 
 		// Member Constructor
@@ -3916,7 +3931,14 @@ namespace DataHeatBalance {
 			QBBRAD( QBBRAD ),
 			NumberOfDevices( NumberOfDevices ),
 			MaxNumberOfDevices( MaxNumberOfDevices ),
-			Device( Device )
+			Device( Device ),
+			SumConvGainRate( 0.0 ),
+			SumReturnAirConvGainRate( 0.0 ),
+			SumRadiantGainRate( 0.0 ),
+			SumLatentGainRate( 0.0 ),
+			SumReturnAirLatentGainRate( 0.0 ),
+			SumCarbonDioxideGainRate( 0.0 ),
+			SumGenericContamGainRate( 0.0 )
 		{}
 
 	};
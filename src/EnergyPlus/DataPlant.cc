@@ -324,6 +324,7 @@ namespace DataPlant {
 	Real64 EconLoadMet( 0.0 ); // Load met by Economizer
 	int TotNumLoops( 0 ); // number of plant and condenser loops
 	int TotNumHalfLoops( 0 ); // number of half loops (2 * TotNumLoops)
+	int NumPlantLoopGroups( 0 ); // number of groups of interconnected loops
 	bool PlantFirstSizeCompleted( false );
 	bool PlantFirstSizesOkayToFinalize( false ); // true if plant sizing is finishing and can save results
 	bool PlantReSizingCompleted( false );
@@ -373,6 +374,7 @@ namespace DataPlant {
 	Array1D< ReportLoopData > VentRepCondSupplySide;
 	Array1D< ReportLoopData > VentRepCondDemandSide;
 	Array1D< PlantCallingOrderInfoStruct > PlantCallingOrderInfo;
+	Array1D< PlantLoopGroupData > PlantLoopGroup; // Groups of loops with no interconnect to other groups
 
 	// Functions
 
@@ -337,6 +337,7 @@ namespace DataPlant {
 	extern Real64 EconLoadMet; // Load met by Economizer
 	extern int TotNumLoops; // number of plant and condenser loops
 	extern int TotNumHalfLoops; // number of half loops (2 * TotNumLoops)
+	extern int NumPlantLoopGroups; // number of groups of interconnected loops
 	extern bool PlantFirstSizeCompleted; //true if first-pass sizing is still going on and not finished
 	extern bool PlantFirstSizesOkayToFinalize; // true if first-pass plant sizing is finish and can save results for simulation
 	extern bool PlantFirstSizesOkayToReport; // true if initial first pass size can be reported
@@ -2302,6 +2303,28 @@ namespace DataPlant {
 
 	};
 
+	struct PlantLoopGroupData
+	{
+		// Members
+		Array1D_int CallingOrderIndex; // PlantCallingOrderInfo indexes of the half loops in this group, in calling order
+		bool HasCommonPipe; // true if a loop in this group has a single or two-way common pipe
+
+		// Default Constructor
+		PlantLoopGroupData() :
+			HasCommonPipe( false )
+		{}
+
+		// Member Constructor
+		PlantLoopGroupData(
+			Array1_int const & CallingOrderIndex, // PlantCallingOrderInfo indexes of the half loops in this group, in calling order
+			bool const HasCommonPipe // true if a loop in this group has a single or two-way common pipe
+		) :
+			CallingOrderIndex( CallingOrderIndex ),
+			HasCommonPipe( HasCommonPipe )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< PipeData > Pipe;
 	extern Array1D< PlantLoopData > PlantLoop;
@@ -2312,6 +2335,7 @@ namespace DataPlant {
 	extern Array1D< ReportLoopData > VentRepCondSupplySide;
 	extern Array1D< ReportLoopData > VentRepCondDemandSide;
 	extern Array1D< PlantCallingOrderInfoStruct > PlantCallingOrderInfo;
+	extern Array1D< PlantLoopGroupData > PlantLoopGroup; // Groups of loops with no interconnect to other groups
 
 	// Functions
 
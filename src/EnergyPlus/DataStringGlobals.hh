@@ -20,6 +20,7 @@ namespace DataStringGlobals {
 	extern std::string outputDxfFileName;
 	extern std::string outputEioFileName;
 	extern std::string outputEndFileName;
+	extern std::string outputPerfLogFileName;
 	extern std::string outputErrFileName;
 	extern std::string outputEsoFileName;
 	extern std::string outputMtdFileName;
@@ -77,6 +77,7 @@ namespace DataStringGlobals {
 	std::string outputDxfFileName("eplusout.dxf");
 	std::string outputEioFileName("eplusout.eio");
 	std::string outputEndFileName("eplusout.end");
+	std::string outputPerfLogFileName("eplusout.perflog");
 	std::string outputErrFileName("eplusout.err");
 	std::string outputEsoFileName("eplusout.eso");
 	std::string outputMtdFileName("eplusout.mtd");
@@ -85,6 +85,8 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	std::string const TraceHVACControllerEnvVar( "TRACE_HVACCONTROLLER" ); // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	std::string const PerformanceLogEnvVar( "PERFORMANCE_LOG" ); // To write phase timings, peak memory and HVAC
+	// iteration counts to the performance log file
 
 	std::string const MinReportFrequencyEnvVar( "MINREPORTFREQUENCY" ); // environment var for reporting frequency.
 	std::string const cDisplayInputInAuditEnvVar( "DISPLAYINPUTINAUDIT" ); // environmental variable that enables the echoing of the input file into the audit file
@@ -110,6 +112,8 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	bool TraceHVACControllerEnvFlag( false ); // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	bool PerformanceLogEnvFlag( false ); // If TRUE writes phase timings, peak memory and HVAC iteration
+	// counts to the performance log file at the end of the run
 	bool ReportDuringWarmup( false ); // True when the report outputs even during warmup
 	bool ReportDuringHVACSizingSimulation( false ); // true when reporting outputs during HVAC sizing Simulation
 	bool ReportDetailedWarmupConvergence( false ); // True when the detailed warmup convergence is requested
@@ -137,6 +141,7 @@ namespace DataSystemVariables {
 	bool lnumActiveSims( false );
 	int MaxNumberOfThreads( 1 );
 	int NumberIntRadThreads( 1 );
+	int NumberZoneAirThreads( 1 ); // Threads used for the zone air heat balance sums
 	int iNominalTotSurfaces( 0 );
 	bool Threading( false );
 
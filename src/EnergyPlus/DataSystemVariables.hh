@@ -54,6 +54,8 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	extern std::string const TraceHVACControllerEnvVar; // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	extern std::string const PerformanceLogEnvVar; // To write phase timings, peak memory and HVAC
+	// iteration counts to the performance log file
 
 	extern std::string const MinReportFrequencyEnvVar; // environment var for reporting frequency.
 	extern std::string const cDisplayInputInAuditEnvVar; // environmental variable that enables the echoing of the input file into the audit file
@@ -79,6 +81,8 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	extern bool TraceHVACControllerEnvFlag; // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	extern bool PerformanceLogEnvFlag; // If TRUE writes phase timings, peak memory and HVAC iteration
+	// counts to the performance log file at the end of the run
 	extern bool ReportDuringWarmup; // True when the report outputs even during warmup
 	extern bool ReportDuringHVACSizingSimulation; // true when reporting outputs during HVAC sizing Simulation
 	extern bool ReportDetailedWarmupConvergence; // True when the detailed warmup convergence is requested
@@ -106,6 +110,7 @@ namespace DataSystemVariables {
 	extern bool lnumActiveSims;
 	extern int MaxNumberOfThreads;
 	extern int NumberIntRadThreads;
+	extern int NumberZoneAirThreads;
 	extern int iNominalTotSurfaces;
 	extern bool Threading;
 
@@ -1,3 +1,15 @@
+// C++ Headers
+#include <chrono>
+#include <fstream>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/gio.hh>
@@ -8,11 +20,16 @@
 #include <DataTimings.hh>
 #include <DataErrorTracking.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DisplayRoutines.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
 #include <Timer.h>
 
+// JSON Headers
+#include <json/json.h>
+
 namespace EnergyPlus {
 
 #ifdef EP_NO_Timings
@@ -51,6 +68,14 @@ namespace DataTimings {
 	// MODULE PARAMETER DEFINITIONS:
 	int const MaxTimingStringLength( 250 ); // string length for timing string array
 
+	int const PhaseGetInput( 1 );
+	int const PhaseSizing( 2 );
+	int const PhaseWarmup( 3 );
+	int const PhaseRunPeriod( 4 );
+	int const PhaseReporting( 5 );
+	int const NumPhases( 5 );
+	Array1D_string const cPhaseNames( NumPhases, { "get_input", "sizing", "warmup", "run_period", "reporting" } );
+
 	// DERIVED TYPE DEFINITIONS
 
 	// INTERFACE BLOCK SPECIFICATIONS
@@ -72,6 +97,18 @@ namespace DataTimings {
 	bool lmanageSimulationTiming( false );
 	bool lcloseoutReportingTiming( false );
 
+	int CurrentPhase( PhaseGetInput );
+	Array1D< Real64 > PhaseElapsedTime( NumPhases, 0.0 );
+	Array1D_int PhaseZoneTimeSteps( NumPhases, 0 );
+	Array1D_int PhaseHVACTimeSteps( NumPhases, 0 );
+	Array1D_int PhaseHVACIterations( NumPhases, 0 );
+	Array1D_int PhaseHVACMaxIterations( NumPhases, 0 );
+
+	namespace {
+		// Start of the current phase, the first phase starts with the program
+		std::chrono::steady_clock::time_point PhaseStartTime( std::chrono::steady_clock::now() );
+	}
+
 	// Following for calls to routines
 #ifdef EP_Count_Calls
 	int NumShadow_Calls( 0 );
@@ -588,6 +625,179 @@ namespace DataTimings {
 
 	}
 
+	void
+	epStartPhase( int const Phase )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the wall clock time since the last call to the current phase and
+		// starts timing Phase.  Calling it with the current phase brings the time
+		// of the current phase up to date.
+
+		// METHODOLOGY EMPLOYED:
+		// The steady clock is used, unlike epElapsedTime it does not wrap at midnight.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		auto const now( std::chrono::steady_clock::now() );
+
+		PhaseElapsedTime( CurrentPhase ) += std::chrono::duration< Real64 >( now - PhaseStartTime ).count();
+		PhaseStartTime = now;
+		CurrentPhase = Phase;
+
+	}
+
+	Int64
+	epPeakMemoryUsage()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the peak resident set size (peak working set on Windows) of the
+		// process in kB, or 0 if it is not available.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS counters;
+		if ( GetProcessMemoryInfo( GetCurrentProcess(), &counters, sizeof( counters ) ) ) {
+			return Int64( counters.PeakWorkingSetSize / 1024 );
+		}
+		return 0;
+#else
+		struct rusage usage;
+		if ( getrusage( RUSAGE_SELF, &usage ) != 0 ) return 0;
+#ifdef __APPLE__
+		return Int64( usage.ru_maxrss / 1024 ); // bytes on OS X
+#else
+		return Int64( usage.ru_maxrss ); // kB on Linux
+#endif
+#endif
+
+	}
+
+	void
+	WritePerformanceLog( bool const Completed ) // true if the simulation completed without a fatal error
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the time spent in each simulation phase, the peak memory use and the
+		// HVAC iteration counts to the performance log file (eplusout.perflog) as JSON.
+		// The log is read by scripts/performance_regression.py.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		using DataStringGlobals::outputPerfLogFileName;
+		using DataStringGlobals::VerString;
+		using DataStringGlobals::inputIdfFileName;
+		using DataStringGlobals::inputWeatherFileName;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Json::Value root;
+		Real64 totalTime( 0.0 );
+		int totalZoneTimeSteps( 0 );
+		int totalHVACTimeSteps( 0 );
+		int totalHVACIterations( 0 );
+		int totalHVACMaxIterations( 0 );
+
+		epStartPhase( CurrentPhase );
+
+		root[ "program_version" ] = VerString;
+		root[ "input_file" ] = inputIdfFileName;
+		root[ "weather_file" ] = inputWeatherFileName;
+		root[ "completed" ] = Completed;
+		root[ "peak_memory" ] = Json::Int64( epPeakMemoryUsage() );
+		root[ "memory_unit" ] = "kB";
+		Json::Value & phases( root[ "phases" ] );
+		for ( int Phase = 1; Phase <= NumPhases; ++Phase ) {
+			Json::Value & phase( phases[ cPhaseNames( Phase ) ] );
+			phase[ "elapsed_time" ] = PhaseElapsedTime( Phase );
+			phase[ "zone_time_steps" ] = PhaseZoneTimeSteps( Phase );
+			phase[ "hvac_time_steps" ] = PhaseHVACTimeSteps( Phase );
+			phase[ "hvac_iterations" ] = PhaseHVACIterations( Phase );
+			phase[ "hvac_max_iterations" ] = PhaseHVACMaxIterations( Phase );
+			totalTime += PhaseElapsedTime( Phase );
+			totalZoneTimeSteps += PhaseZoneTimeSteps( Phase );
+			totalHVACTimeSteps += PhaseHVACTimeSteps( Phase );
+			totalHVACIterations += PhaseHVACIterations( Phase );
+			totalHVACMaxIterations += PhaseHVACMaxIterations( Phase );
+		}
+		root[ "elapsed_time" ] = totalTime;
+		root[ "zone_time_steps" ] = totalZoneTimeSteps;
+		root[ "hvac_time_steps" ] = totalHVACTimeSteps;
+		root[ "hvac_iterations" ] = totalHVACIterations;
+		root[ "hvac_max_iterations" ] = totalHVACMaxIterations;
+		root[ "time_unit" ] = "s";
+
+		std::ofstream perfLog( outputPerfLogFileName );
+		if ( ! perfLog ) {
+			DisplayString( "WritePerformanceLog: Could not open file " + outputPerfLogFileName + " for output (write)." );
+			return;
+		}
+		Json::StreamWriterBuilder builder;
+		builder[ "indentation" ] = "  ";
+		perfLog << Json::writeString( builder, root ) << '\n';
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -44,6 +44,22 @@ namespace DataTimings {
 	extern bool lmanageSimulationTiming;
 	extern bool lcloseoutReportingTiming;
 
+	// Simulation phases reported in the performance log
+	extern int const PhaseGetInput; // input processing and simulation setup
+	extern int const PhaseSizing; // zone, system and plant sizing and HVAC sizing simulations
+	extern int const PhaseWarmup; // warmup days of the design day and run period simulations
+	extern int const PhaseRunPeriod; // design day and run period days after warmup
+	extern int const PhaseReporting; // tabular reports and closeout
+	extern int const NumPhases;
+	extern Array1D_string const cPhaseNames;
+
+	extern int CurrentPhase; // simulation phase being timed
+	extern Array1D< Real64 > PhaseElapsedTime; // wall clock time spent in each phase {s}
+	extern Array1D_int PhaseZoneTimeSteps; // zone time steps simulated in each phase
+	extern Array1D_int PhaseHVACTimeSteps; // SimHVAC calls in each phase
+	extern Array1D_int PhaseHVACIterations; // HVAC iterations in each phase
+	extern Array1D_int PhaseHVACMaxIterations; // SimHVAC calls that reached the maximum iterations in each phase
+
 	// Following for calls to routines
 #ifdef EP_Count_Calls
 	extern int NumShadow_Calls;
@@ -126,6 +142,15 @@ namespace DataTimings {
 	Real64
 	epElapsedTime();
 
+	void
+	epStartPhase( int const Phase );
+
+	Int64
+	epPeakMemoryUsage();
+
+	void
+	WritePerformanceLog( bool const Completed );
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
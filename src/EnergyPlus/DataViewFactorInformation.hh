@@ -25,6 +25,18 @@ namespace DataViewFactorInformation {
 
 	// Types
 
+	struct ScriptFCacheEntry
+	{
+		// Members
+		Array1D< Real64 > Emissivity; // Surface emissivities the Script F was calculated for
+		Array2D< Real64 > ScriptF; // Hottel's Script F times the Stefan-Boltzmann constant //Tuned Transposed
+
+		// Default Constructor
+		ScriptFCacheEntry()
+		{}
+
+	};
+
 	struct ZoneViewFactorInformation
 	{
 		// Members
@@ -38,10 +50,15 @@ namespace DataViewFactorInformation {
 		Array1D< Real64 > Tilt; // Tilt angle of the surface (in degrees)
 		Array1D_int SurfacePtr; // Surface ALLOCATABLE (to Surface derived type)
 		Array1D_string Class; // Class of surface (Wall, Roof, etc.)
+		Array1D< ScriptFCacheEntry > ScriptFCache; // Script F of recently seen window shading states
+		int NumScriptFCached; // Number of entries of ScriptFCache in use
+		int NextScriptFCacheEntry; // Entry of ScriptFCache to overwrite next when it is full
 
 		// Default Constructor
 		ZoneViewFactorInformation() :
-			NumOfSurfaces( 0 )
+			NumOfSurfaces( 0 ),
+			NumScriptFCached( 0 ),
+			NextScriptFCacheEntry( 1 )
 		{}
 
 		// Member Constructor
@@ -66,7 +83,9 @@ namespace DataViewFactorInformation {
 			Azimuth( Azimuth ),
 			Tilt( Tilt ),
 			SurfacePtr( SurfacePtr ),
-			Class( Class )
+			Class( Class ),
+			NumScriptFCached( 0 ),
+			NextScriptFCacheEntry( 1 )
 		{}
 
 	};
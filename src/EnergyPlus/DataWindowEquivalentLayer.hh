@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -181,6 +182,9 @@ namespace DataWindowEquivalentLayer {
 		//        lscVBNOBM: exclude beam (max visibility w/o beam)
 		//                   PHI_DEG altered to just exclude beam
 		//                   PHI_DEG = 20 if diffuse only
+		Array2D< CFSSWP > SWP_TBL; // VB, PD: beam off-normal properties tabulated over the
+		//   profile angle(s) and slat angle (see SetupOffNormalPropertyTable())
+		//   empty if the properties are evaluated directly
 
 		// Default Constructor
 		CFSLAYER() :
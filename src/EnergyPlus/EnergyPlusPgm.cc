@@ -32,6 +32,7 @@
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
 #include <Psychrometrics.hh>
+#include <ReadVars.hh>
 #include <ScheduleManager.hh>
 #include <SimulationManager.hh>
 #include <UtilityRoutines.hh>
@@ -195,7 +196,7 @@ EnergyPlusPgm( std::string const & filepath )
 	// PROGRAM INFORMATION:
 	//       AUTHOR         Linda K. Lawrie, et al
 	//       DATE WRITTEN   January 1997.....
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, read the PERFORMANCE_LOG environment variable
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS PROGRAM:
@@ -354,6 +355,9 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( TraceHVACControllerEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TraceHVACControllerEnvFlag = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( PerformanceLogEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) PerformanceLogEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
 	if ( ! filepath.empty() ) {
 		// if filepath is not empty, then we are using E+ as a library API call
 		// change the directory to the specified folder, and pass in dummy args to command line parser
@@ -396,14 +400,6 @@ EnergyPlusPgm( std::string const & filepath )
 	ReportOrphanSchedules();
 
     if (runReadVars) {
-		std::string readVarsPath = exeDirectory + "ReadVarsESO" + exeExtension;
-		bool FileExists;
-		{ IOFlags flags; gio::inquire( readVarsPath, flags ); FileExists = flags.exists(); }
-		if (!FileExists) {
-			DisplayString("ERROR: Could not find ReadVarsESO executable: " + getAbsolutePath(readVarsPath) + "." );
-			exit(EXIT_FAILURE);
-		}
-
 		std::string RVIfile = idfDirPathName + idfFileNameOnly + ".rvi";
     	std::string MVIfile = idfDirPathName + idfFileNameOnly + ".mvi";
 
@@ -438,11 +434,8 @@ EnergyPlusPgm( std::string const & filepath )
 			gio::close( fileUnitNumber );
     	}
 
-    	std::string readVarsRviCommand = "\"" + readVarsPath + "\"" + " " + RVIfile + " unlimited";
-    	std::string readVarsMviCommand = "\"" + readVarsPath + "\"" + " " + MVIfile + " unlimited";
-
-    	systemCall(readVarsRviCommand);
-    	systemCall(readVarsMviCommand);
+    	ReadVars::ProcessVariableFile( RVIfile, "readvars.audit" );
+    	ReadVars::ProcessVariableFile( MVIfile, "readvars.audit" );
 
 	    if (!rviFileExists)
 	    	removeFile(RVIfile.c_str());
@@ -1,6 +1,7 @@
 // FMI-Related Headers
 extern "C" {
 #include <FMI/main.h>
+#include <BCVTB/utilShm.h>
 #include <BCVTB/utilSocket.h>
 #include <BCVTB/utilXml.h>
 }
@@ -74,6 +75,7 @@ namespace ExternalInterface {
 	int const fmiFatal( 4 ); // fmiPending
 	int const fmiPending( 5 ); // fmiPending
 	std::string const socCfgFilNam( "socket.cfg" ); // socket configuration file
+	std::string const shmCfgFilNam( "shm.cfg" ); // shared memory configuration file
 	std::string const BlankString;
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -95,6 +97,7 @@ namespace ExternalInterface {
 	Array1D_int varTypes; // Types of variables in keyVarIndexes
 	Array1D_int varInd; // Index of ErlVariables for ExternalInterface
 	int socketFD( -1 ); // socket file descriptor
+	int shmFD( -1 ); // shared memory descriptor, used instead of the socket if shm.cfg exists
 	bool ErrorsFound( false ); // Set to true if errors are found
 	bool noMoreValues( false ); // Flag, true if no more values
 	// will be sent by the server
@@ -304,7 +307,7 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   9Jan2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, send the message through shared memory if used
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -319,8 +322,14 @@ namespace ExternalInterface {
 
 		if ( ( NumExternalInterfacesBCVTB != 0 ) || ( NumExternalInterfacesFMUExport != 0 ) ) {
 			if ( ErrorsFound ) {
-				// Check if the socket is open
-				if ( socketFD >= 0 ) {
+				// Check if the shared memory or the socket is open
+				if ( shmFD >= 0 ) {
+					if ( simulationStatus == 1 ) {
+						retVal = sendclientmessageshm( &shmFD, &flag1 );
+					} else {
+						retVal = sendclientmessageshm( &shmFD, &flag2 );
+					}
+				} else if ( socketFD >= 0 ) {
 					// Socket is open
 					if ( simulationStatus == 1 ) {
 						retVal = sendclientmessage( &socketFD, &flag1 );
@@ -344,7 +353,7 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   December 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, shared memory
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -358,17 +367,26 @@ namespace ExternalInterface {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int retVal; // Return value, needed to catch return value of function call
 		bool fileExist; // Set to true if file exists
+		bool shmFileExist; // Set to true if shared memory configuration file exists
 
 		// Try to establish socket connection. This is needed if Ptolemy started E+,
 		//  but E+ had an error before the call to InitExternalInterface.
 
 		{ IOFlags flags; gio::inquire( socCfgFilNam, flags ); fileExist = flags.exists(); }
+		{ IOFlags flags; gio::inquire( shmCfgFilNam, flags ); shmFileExist = flags.exists(); }
 
-		if ( ( socketFD == -1 ) && fileExist ) {
+		if ( ( shmFD == -1 ) && ( socketFD == -1 ) && shmFileExist ) {
+			shmFD = establishclientshm( shmCfgFilNam.c_str() );
+		}
+		if ( ( shmFD == -1 ) && ( socketFD == -1 ) && fileExist ) {
 			socketFD = establishclientsocket( socCfgFilNam.c_str() );
 		}
 
-		if ( socketFD >= 0 ) {
+		if ( shmFD >= 0 ) {
+			retVal = sendclientmessageshm( &shmFD, &FlagToWriteToSocket );
+			// The server removes the file, the client only detaches
+			closeshm( &shmFD );
+		} else if ( socketFD >= 0 ) {
 			retVal = sendclientmessage( &socketFD, &FlagToWriteToSocket );
 			// Don't close socket as this may give sometimes an IOException in Windows
 			// This problem seems to affect only Windows but not Mac
@@ -427,6 +445,7 @@ namespace ExternalInterface {
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   2Dec2007
 		//       MODIFIED       Rui Zhang Aug 2009
+		//                      Oct 2026, shared memory for BCVTB if shm.cfg exists
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -457,6 +476,8 @@ namespace ExternalInterface {
 		std::string validateErrMsg; // error returned when xml Schema validate failed
 		bool socFileExist; // Set to true if socket configuration
 		// file exists
+		bool shmFileExist; // Set to true if shared memory configuration
+		// file exists
 		bool simFileExist; // Set to true if simulation configuration
 		// file exists
 
@@ -474,9 +495,17 @@ namespace ExternalInterface {
 				}
 			}
 
-			// Get port number
+			// Get shared memory file name or port number. Shared memory
+			// is used for the BCVTB if the peer runs on the same computer.
+			{ IOFlags flags; gio::inquire( shmCfgFilNam, flags ); shmFileExist = flags.exists(); }
 			{ IOFlags flags; gio::inquire( socCfgFilNam, flags ); socFileExist = flags.exists(); }
-			if ( socFileExist ) {
+			if ( shmFileExist && haveExternalInterfaceBCVTB ) {
+				shmFD = establishclientshm( shmCfgFilNam.c_str() );
+				if ( shmFD < 0 ) {
+					ShowSevereError( "ExternalInterface: Could not open shared memory file specified in \"" + shmCfgFilNam + "\". Descriptor = " + TrimSigDigits( shmFD ) + '.' );
+					ErrorsFound = true;
+				}
+			} else if ( socFileExist ) {
 				socketFD = establishclientsocket( socCfgFilNam.c_str() );
 				if ( socketFD < 0 ) {
 					ShowSevereError( "ExternalInterface: Could not open socket. File descriptor = " + TrimSigDigits( socketFD ) + '.' );
@@ -1967,7 +1996,7 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   2Dec2007
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, exchange through shared memory if used
 		//       RE-ENGINEERED  na
 
 		// Using/Aliasing
@@ -2041,7 +2070,9 @@ namespace ExternalInterface {
 			// Exchange data with socket
 			retVal = 0;
 			flaRea = 0;
-			if ( haveExternalInterfaceBCVTB ) {
+			if ( haveExternalInterfaceBCVTB && ( shmFD >= 0 ) ) {
+				retVal = exchangedoubleswithshm( &shmFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_ );
+			} else if ( haveExternalInterfaceBCVTB ) {
 				retVal = exchangedoubleswithsocket( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_ );
 			} else if ( haveExternalInterfaceFMUExport ) {
 				retVal = exchangedoubleswithsocketFMU( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_, &FMUExportActivate );
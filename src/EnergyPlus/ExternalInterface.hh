@@ -51,6 +51,7 @@ namespace ExternalInterface {
 	extern int const fmiFatal;       // fmiPending
 	extern int const fmiPending;     // fmiPending
 	extern std::string const socCfgFilNam; // socket configuration file
+	extern std::string const shmCfgFilNam; // shared memory configuration file
 	extern std::string const BlankString;
 
 	struct fmuInputVariableType {
@@ -305,6 +306,7 @@ namespace ExternalInterface {
 	extern Array1D< int > varTypes; // Types of variables in keyVarIndexes
 	extern Array1D< int > varInd; // Index of ErlVariables for ExternalInterface
 	extern int socketFD; // socket file descriptor
+	extern int shmFD; // shared memory descriptor, used instead of the socket if shm.cfg exists
 	extern bool ErrorsFound; // Set to true if errors are found
 	extern bool noMoreValues; //Flag, true if no more values
 	// will be sent by the server
@@ -4886,12 +4886,12 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoLowTempIndex );
-			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).RhoLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).RhoHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).RhoTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).RhoTemps( Loop - 1 ), GlycolData( GlycolIndex ).RhoTemps( Loop ), GlycolData( GlycolIndex ).RhoValues( Loop - 1 ), GlycolData( GlycolIndex ).RhoValues( Loop ) );
-				break; // DO loop
+			auto const & glycol_data( GlycolData( GlycolIndex ) );
+			ReturnValue = glycol_data.RhoValues( glycol_data.RhoLowTempIndex );
+			// bracket is temp > low, <= high (for interpolation), found by interval halving
+			Loop = FindArrayIndex( Temperature, glycol_data.RhoTemps, glycol_data.RhoLowTempIndex, glycol_data.RhoHighTempIndex ) + 1;
+			if ( Loop <= glycol_data.RhoHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.RhoTemps( Loop - 1 ), glycol_data.RhoTemps( Loop ), glycol_data.RhoValues( Loop - 1 ), glycol_data.RhoValues( Loop ) );
 			}
 		}
 
@@ -5027,12 +5027,12 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondLowTempIndex );
-			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).CondLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).CondHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).CondTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).CondTemps( Loop - 1 ), GlycolData( GlycolIndex ).CondTemps( Loop ), GlycolData( GlycolIndex ).CondValues( Loop - 1 ), GlycolData( GlycolIndex ).CondValues( Loop ) );
-				break; // DO loop
+			auto const & glycol_data( GlycolData( GlycolIndex ) );
+			ReturnValue = glycol_data.CondValues( glycol_data.CondLowTempIndex );
+			// bracket is temp > low, <= high (for interpolation), found by interval halving
+			Loop = FindArrayIndex( Temperature, glycol_data.CondTemps, glycol_data.CondLowTempIndex, glycol_data.CondHighTempIndex ) + 1;
+			if ( Loop <= glycol_data.CondHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.CondTemps( Loop - 1 ), glycol_data.CondTemps( Loop ), glycol_data.CondValues( Loop - 1 ), glycol_data.CondValues( Loop ) );
 			}
 		}
 
@@ -5168,12 +5168,12 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscLowTempIndex );
-			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).ViscLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).ViscHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).ViscTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).ViscTemps( Loop - 1 ), GlycolData( GlycolIndex ).ViscTemps( Loop ), GlycolData( GlycolIndex ).ViscValues( Loop - 1 ), GlycolData( GlycolIndex ).ViscValues( Loop ) );
-				break; // DO loop
+			auto const & glycol_data( GlycolData( GlycolIndex ) );
+			ReturnValue = glycol_data.ViscValues( glycol_data.ViscLowTempIndex );
+			// bracket is temp > low, <= high (for interpolation), found by interval halving
+			Loop = FindArrayIndex( Temperature, glycol_data.ViscTemps, glycol_data.ViscLowTempIndex, glycol_data.ViscHighTempIndex ) + 1;
+			if ( Loop <= glycol_data.ViscHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.ViscTemps( Loop - 1 ), glycol_data.ViscTemps( Loop ), glycol_data.ViscValues( Loop - 1 ), glycol_data.ViscValues( Loop ) );
 			}
 		}
 
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 
 // ObjexxFCL Headers
@@ -913,6 +914,7 @@ namespace GroundHeatExchangers {
 		Real64 C3; // **temperature at the U tube outlet.
 		static int PrevN( 1 ); // The saved value of N at previous time step
 		int IndexN; // Used to index the LastHourN array
+		int hourlyRow; // Row of hourlyGFunc holding the g-functions for this sub-hour offset
 		static bool updateCurSimTime( true ); // Used to reset the CurSimTime to reset after WarmupFlag
 		static bool triggerDesignDayReset( false );
 		static bool firstTime( true );
@@ -967,13 +969,13 @@ namespace GroundHeatExchangers {
 		// Store currentSimTime in prevTimeSteps only if a time step occurs
 
 		if ( prevTimeSteps( 1 ) != currentSimTime ) {
-			prevTimeSteps = eoshift( prevTimeSteps, -1, currentSimTime );
+			pushHistory( prevTimeSteps, currentSimTime );
 			++N;
 		}
 
 		if ( N != PrevN ) {
 			PrevN = N;
-			QnSubHr = eoshift( QnSubHr, -1, lastQnSubHr );
+			pushHistory( QnSubHr, lastQnSubHr );
 		}
 
 		calcAggregateLoad();
@@ -981,6 +983,9 @@ namespace GroundHeatExchangers {
 		// Update the heat exchanger resistance each time
 		calcHXResistance();
 
+		// The hourly load blocks always sit a whole number of hours plus the same sub-hour offset in the past
+		hourlyRow = getHourlyGFuncRow( currentSimTime - int( currentSimTime ) );
+
 		if ( N == 1 ) {
 			if ( massFlowRate <= 0.0 ) {
 				tmpQnSubHourly = 0.0;
@@ -1038,7 +1043,7 @@ namespace GroundHeatExchangers {
 						sumQnHourly += QnHr( I ) * RQHour;
 						break;
 					}
-					gFuncVal = getGFunc( ( currentSimTime - int( currentSimTime ) + I ) / ( timeSSFactor ) );
+					gFuncVal = hourlyGFunc( hourlyRow, I );
 					RQHour = gFuncVal / ( kGroundFactor );
 					sumQnHourly += ( QnHr( I ) - QnHr( I + 1 ) ) * RQHour;
 				}
@@ -1094,12 +1099,12 @@ namespace GroundHeatExchangers {
 				sumQnHourly = 0.0;
 				for ( I = 1 + SubAGG; I <= hourlyLimit; ++I ) {
 					if ( I == hourlyLimit ) {
-						gFuncVal = getGFunc( ( currentSimTime - int( currentSimTime ) + I ) / ( timeSSFactor ) );
+						gFuncVal = hourlyGFunc( hourlyRow, I );
 						RQHour = gFuncVal / ( kGroundFactor );
 						sumQnHourly += ( QnHr( I ) - QnMonthlyAgg( currentMonth ) ) * RQHour;
 						break;
 					}
-					gFuncVal = getGFunc( ( currentSimTime - int( currentSimTime ) + I ) / ( timeSSFactor ) );
+					gFuncVal = hourlyGFunc( hourlyRow, I );
 					RQHour = gFuncVal / ( kGroundFactor );
 					sumQnHourly += ( QnHr( I ) - QnHr( I + 1 ) ) * RQHour;
 				}
@@ -1250,8 +1255,8 @@ namespace GroundHeatExchangers {
 				SumQnHr += QnSubHr( J ) * std::abs( prevTimeSteps( J ) - prevTimeSteps( J + 1 ) );
 			}
 			SumQnHr /= std::abs( prevTimeSteps( 1 ) - prevTimeSteps( J ) );
-			QnHr = eoshift( QnHr, -1, SumQnHr );
-			LastHourN = eoshift( LastHourN, -1, N );
+			pushHistory( QnHr, SumQnHr );
+			pushHistory( LastHourN, N );
 		}
 
 		//CHECK IF A MONTH PASSES...
@@ -1271,6 +1276,86 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	int
+	GLHEBase::getHourlyGFuncRow(
+		Real64 const subHourOffset // Time past the last whole simulation hour [hr]
+	)
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the row of hourlyGFunc holding the g-functions of the hourly load blocks
+		// for the given sub-hour offset, evaluating the row if it has not been seen yet.
+
+		// METHODOLOGY EMPLOYED:
+		// The hourly superposition evaluates the g-function at (offset + I) / timeSSFactor for
+		// every hourly block I. Only the offset changes from step to step and it repeats every
+		// hour, so the g-functions for each offset are evaluated once and reused for the rest
+		// of the simulation. This removes several hundred log and table searches per time step.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const offsetTolerance( 1.0e-8 ); // Offsets closer than this share a row [hr]
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int row;
+		int I;
+
+		if ( hourlyGFuncTimeSSFactor != timeSSFactor || hourlyGFunc.size2() != QnHr.size() ) {
+			hourlyGFunc.allocate( maxTSinHr, QnHr.isize() );
+			hourlyGFuncOffset.dimension( maxTSinHr, 0.0 );
+			numHourlyGFuncOffsets = 0;
+			hourlyGFuncTimeSSFactor = timeSSFactor;
+		}
+
+		for ( row = 1; row <= numHourlyGFuncOffsets; ++row ) {
+			if ( std::abs( hourlyGFuncOffset( row ) - subHourOffset ) < offsetTolerance ) return row;
+		}
+
+		// More distinct offsets than time steps in an hour; start over rather than grow without bound
+		if ( numHourlyGFuncOffsets == maxTSinHr ) numHourlyGFuncOffsets = 0;
+
+		row = ++numHourlyGFuncOffsets;
+		hourlyGFuncOffset( row ) = subHourOffset;
+		for ( I = 1; I <= QnHr.isize(); ++I ) {
+			hourlyGFunc( row, I ) = getGFunc( ( subHourOffset + I ) / ( timeSSFactor ) );
+		}
+
+		return row;
+	}
+
+	//******************************************************************************
+
+	void
+	pushHistory(
+		Array1D< Real64 > & history,
+		Real64 const newValue
+	)
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Shifts a history array back one slot in place and stores the newest value in slot 1.
+		// Same result as eoshift( history, -1, newValue ) without allocating a new array.
+
+		if ( history.empty() ) return;
+		std::copy_backward( history.begin(), history.end() - 1, history.end() );
+		history( 1 ) = newValue;
+	}
+
+	//******************************************************************************
+
+	void
+	pushHistory(
+		Array1D_int & history,
+		int const newValue
+	)
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Integer version of pushHistory.
+
+		if ( history.empty() ) return;
+		std::copy_backward( history.begin(), history.end() - 1, history.end() );
+		history( 1 ) = newValue;
+	}
+
+	//******************************************************************************
+
 	void
 	GetGroundHeatExchangerInput()
 	{
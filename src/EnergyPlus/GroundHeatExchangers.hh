@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -63,6 +64,10 @@ namespace GroundHeatExchangers {
 		int SubAGG; // Minimum subhourly History
 		Array1D_int LastHourN; // Stores the Previous hour's N for past hours
 		// until the minimum subhourly history
+		Array2D< Real64 > hourlyGFunc; // G-functions of the hourly load blocks, one row per sub-hour offset
+		Array1D< Real64 > hourlyGFuncOffset; // Sub-hour offset [hr] each row of hourlyGFunc was evaluated at
+		int numHourlyGFuncOffsets; // Number of rows of hourlyGFunc in use
+		Real64 hourlyGFuncTimeSSFactor; // Steady state time factor hourlyGFunc was evaluated with
 		//loop topology variables
 		Real64 boreholeTemp; // [C]
 		Real64 massFlowRate; // [kg/s]
@@ -103,6 +108,8 @@ namespace GroundHeatExchangers {
 			NPairs( 0 ),
 			AGG( 0 ),
 			SubAGG( 0 ),
+			numHourlyGFuncOffsets( 0 ),
+			hourlyGFuncTimeSSFactor( 0.0 ),
 			boreholeTemp( 0.0 ),
 			massFlowRate( 0.0 ),
 			outletTemp( 0.0 ),
@@ -138,6 +145,11 @@ namespace GroundHeatExchangers {
 		Real64
 		interpGFunc( Real64 );
 
+		int
+		getHourlyGFuncRow(
+			Real64 const subHourOffset
+		);
+
 		virtual Real64
 		getGFunc( Real64 )=0;
 
@@ -357,6 +369,18 @@ namespace GroundHeatExchangers {
 	void
 	GetGroundHeatExchangerInput();
 
+	void
+	pushHistory(
+		Array1D< Real64 > & history,
+		Real64 const newValue
+	);
+
+	void
+	pushHistory(
+		Array1D_int & history,
+		int const newValue
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -831,6 +831,8 @@ namespace HVACControllers {
 		ControllerProps( ControlNum ).ReusePreviousSolutionFlag = true;
 		// Always reset to false by default. Set in CalcSimpleController() on the first controller iteration.
 		ControllerProps( ControlNum ).ReuseIntermediateSolutionFlag = false;
+		// Always reset to false by default. Set in CalcSimpleController() on the first controller iteration.
+		ControllerProps( ControlNum ).SeedFromPreviousSolutionFlag = false;
 		// By default not converged
 		IsConvergedFlag = false;
 
@@ -1098,6 +1100,9 @@ namespace HVACControllers {
 			ControllerProps( ControlNum ).SolutionTrackers.DefinedFlag() = false;
 			ControllerProps( ControlNum ).SolutionTrackers.Mode() = iModeNone;
 			ControllerProps( ControlNum ).SolutionTrackers.ActuatedValue() = 0.0;
+			for ( auto & SolutionTracker : ControllerProps( ControlNum ).SolutionTrackers ) {
+				SolutionTracker.Slope = 0.0;
+			}
 
 			MyEnvrnFlag( ControlNum ) = false;
 		}
@@ -1341,6 +1346,9 @@ namespace HVACControllers {
 		//                      - Checking for inactive mode as soon as min and max
 		//                        support points are known instead of in NormActuatedCalc
 		//                        mode.
+		//       MODIFIED       Oct 2026
+		//                      - Seed the cold start with the active solution saved at the previous
+		//                        call to SimAirLoop() instead of the min point (see SeedFromPreviousSolutionFlag).
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1377,6 +1385,8 @@ namespace HVACControllers {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ActuatedNode;
 		int SensedNode;
+		int PreviousSolutionIndex;
+		Real64 PreviousSolutionValue;
 
 		// Increment counter
 		++ControllerProps( ControlNum ).NumCalcCalls;
@@ -1438,6 +1448,27 @@ namespace HVACControllers {
 					ShowFatalError( "Preceding error causes program termination." );
 				}}
 
+				if ( FirstHVACIteration ) {
+					PreviousSolutionIndex = 1;
+				} else {
+					PreviousSolutionIndex = 2;
+				}
+
+				// Start from the active solution saved at the previous call to SimAirLoop() if available.
+				// The min/max constrained cases are then detected once the root finder has bracketed the
+				// root, instead of on the first iterations. Not attempted for the dual temperature and
+				// humidity ratio strategy until the setpoint is known (see above).
+				// The min/max points are not flagged as defined until they have been evaluated, so the
+				// previous solution is checked against the current min/max range explicitly.
+				PreviousSolutionValue = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue;
+				ControllerProps( ControlNum ).SeedFromPreviousSolutionFlag = ControllerProps( ControlNum ).ReusePreviousSolutionFlag && ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag && ( ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode == iModeActive ) && ( ControllerProps( ControlNum ).IsSetPointDefinedFlag || ControllerProps( ControlNum ).ControlVar != iTemperatureAndHumidityRatio ) && ( PreviousSolutionValue >= RootFinders( ControlNum ).MinPoint.X ) && ( PreviousSolutionValue <= RootFinders( ControlNum ).MaxPoint.X );
+
+				if ( ControllerProps( ControlNum ).SeedFromPreviousSolutionFlag ) {
+					ControllerProps( ControlNum ).NextActuatedValue = PreviousSolutionValue;
+					// The previous solution can only be used once per HVAC iteration
+					ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+				}
+
 			}
 
 			// Process current iterate and compute next candidate if needed
@@ -1494,8 +1525,9 @@ namespace HVACControllers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Dimitri Curtil (LBNL)
 		//       DATE WRITTEN   March 2006
-		//       MODIFIED       na
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026
+		//                      - Estimate the second candidate of a seeded cold start from the slope
+		//                        saved with the previous solution.
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1534,6 +1566,8 @@ namespace HVACControllers {
 		bool PreviousSolutionDefinedFlag;
 		int PreviousSolutionMode;
 		Real64 PreviousSolutionValue;
+		Real64 PreviousSolutionSlope;
+		Real64 SlopeCandidate;
 
 		// Obtain actuated and sensed nodes
 		ActuatedNode = ControllerProps( ControlNum ).ActuatedNode;
@@ -1560,6 +1594,7 @@ namespace HVACControllers {
 			PreviousSolutionDefinedFlag = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag;
 			PreviousSolutionMode = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode;
 			PreviousSolutionValue = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue;
+			PreviousSolutionSlope = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Slope;
 
 			// Attempt to use root at previous HVAC step in place of the candidate produced by the
 			// root finder.
@@ -1577,6 +1612,16 @@ namespace HVACControllers {
 
 				// Turn off flag since we can only use the previous solution once per HVAC iteration
 				ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+			} else if ( ControllerProps( ControlNum ).SeedFromPreviousSolutionFlag && ( RootFinders( ControlNum ).NumHistory == 1 ) && ( PreviousSolutionSlope != 0.0 ) ) {
+				// Cold start was seeded with the previous solution but did not converge on it:
+				// take a Newton step with the slope saved at the previous solution rather than
+				// falling back on the min point proposed by the root finder.
+				SlopeCandidate = ControllerProps( ControlNum ).ActuatedValue - ControllerProps( ControlNum ).DeltaSensed / PreviousSolutionSlope;
+				if ( ( SlopeCandidate != ControllerProps( ControlNum ).ActuatedValue ) && ( SlopeCandidate >= RootFinders( ControlNum ).MinPoint.X ) && ( SlopeCandidate <= RootFinders( ControlNum ).MaxPoint.X ) && CheckRootFinderCandidate( RootFinders( ControlNum ), SlopeCandidate ) ) {
+					ControllerProps( ControlNum ).NextActuatedValue = SlopeCandidate;
+				} else {
+					ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
+				}
 			} else {
 				// By default, use candidate value computed by root finder
 				ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
@@ -2028,7 +2073,7 @@ namespace HVACControllers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Dimitri Curtil
 		//       DATE WRITTEN   April 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, also save the residual slope between the final brackets
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2070,6 +2115,12 @@ namespace HVACControllers {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = true;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue = ControllerProps( ControlNum ).NextActuatedValue;
+				// Keep the slope from an earlier solution if the root was found without both brackets
+				auto const & LowerPoint( RootFinders( ControlNum ).LowerPoint );
+				auto const & UpperPoint( RootFinders( ControlNum ).UpperPoint );
+				if ( LowerPoint.DefinedFlag && UpperPoint.DefinedFlag && ( UpperPoint.X != LowerPoint.X ) ) {
+					ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Slope = ( UpperPoint.Y - LowerPoint.Y ) / ( UpperPoint.X - LowerPoint.X );
+				}
 			} else {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = false;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
@@ -2448,6 +2499,11 @@ namespace HVACControllers {
 
 			AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).MaxIterations( Mode ) = max( AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).MaxIterations( Mode ), IterationCount );
 
+			if ( ( Mode == iModeActive ) && ControllerProps( ControlIndex ).SeedFromPreviousSolutionFlag ) {
+				++AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).NumSeededCalls;
+				AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).TotSeededIterations += IterationCount;
+			}
+
 		}
 
 	}
@@ -2538,7 +2594,7 @@ Label100: ;
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Dimitri Curtil
 		//       DATE WRITTEN   April 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, added statistics for the cold starts seeded with the previous solution
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2576,6 +2632,8 @@ Label100: ;
 		int MaxIterations;
 		Real64 AvgIterations;
 		int iModeNum;
+		int NumColdCalls;
+		Real64 AvgColdIterations;
 
 		// FLOW
 
@@ -2675,6 +2733,28 @@ Label100: ;
 
 			}
 
+			auto const & ThisControllerStats( ThisAirLoopStats.ControllerStats( AirLoopControlNum ) );
+
+			// Number of active solutions whose cold start was seeded with the previous solution
+			gio::write( FileUnit, fmtAA ) << "NumSeededCalls" << TrimSigDigits( ThisControllerStats.NumSeededCalls );
+			if ( ThisControllerStats.NumSeededCalls == 0 ) {
+				AvgIterations = 0.0;
+			} else {
+				AvgIterations = double( ThisControllerStats.TotSeededIterations ) / double( ThisControllerStats.NumSeededCalls );
+			}
+			gio::write( FileUnit, fmtAA ) << "AvgSeededIterations" << TrimSigDigits( AvgIterations, 10 );
+
+			// Average number of iterations of the other active solutions, and an estimate of the iterations
+			// saved by seeding assuming the seeded solutions would have needed as many
+			NumColdCalls = ThisControllerStats.NumCalls( iModeActive ) - ThisControllerStats.NumSeededCalls;
+			if ( NumColdCalls == 0 ) {
+				AvgColdIterations = 0.0;
+			} else {
+				AvgColdIterations = double( ThisControllerStats.TotIterations( iModeActive ) - ThisControllerStats.TotSeededIterations ) / double( NumColdCalls );
+			}
+			gio::write( FileUnit, fmtAA ) << "AvgColdIterations" << TrimSigDigits( AvgColdIterations, 10 );
+			gio::write( FileUnit, fmtAA ) << "EstimatedIterationsSaved" << TrimSigDigits( ThisControllerStats.NumSeededCalls * AvgColdIterations - ThisControllerStats.TotSeededIterations, 2 );
+
 		}
 
 	}
@@ -92,12 +92,14 @@ namespace HVACControllers {
 		bool DefinedFlag; // Flag set to TRUE when tracker is up-to-date. FALSE otherwise.
 		Real64 ActuatedValue; // Actuated value
 		int Mode; // Operational model of controller
+		Real64 Slope; // Slope of DeltaSensed versus actuated value near the solution. 0 if unknown.
 
 		// Default Constructor
 		SolutionTrackerType() :
 			DefinedFlag( true ),
 			ActuatedValue( 0.0 ),
-			Mode( iModeNone )
+			Mode( iModeNone ),
+			Slope( 0.0 )
 		{}
 
 		// Member Constructor
@@ -108,7 +110,8 @@ namespace HVACControllers {
 		) :
 			DefinedFlag( DefinedFlag ),
 			ActuatedValue( ActuatedValue ),
-			Mode( Mode )
+			Mode( Mode ),
+			Slope( 0.0 )
 		{}
 
 	};
@@ -140,6 +143,10 @@ namespace HVACControllers {
 		// Flag used to decide whether or not it is possible to reuse the solution from
 		// the last call to SimAirLoop() as a possible candidate.
 		bool ReusePreviousSolutionFlag;
+		// Flag set when the cold start was seeded with the solution from the last call to SimAirLoop()
+		// (see CalcSimpleController()). The second candidate is then estimated from the slope saved
+		// with that solution.
+		bool SeedFromPreviousSolutionFlag;
 		// Array of solution trackers. Saved at last call to SimAirLoop() in ManageControllers(iControllerOpEnd)
 		// The first tracker is used to track the solution when FirstHVACIteration is TRUE.
 		// The second tracker is used to track the solution at FirstHVACIteration is FALSE.
@@ -206,6 +213,7 @@ namespace HVACControllers {
 			DoWarmRestartFlag( false ),
 			ReuseIntermediateSolutionFlag( false ),
 			ReusePreviousSolutionFlag( false ),
+			SeedFromPreviousSolutionFlag( false ),
 			SolutionTrackers( 2 ),
 			MaxAvailActuated( 0.0 ),
 			MaxAvailSensed( 0.0 ),
@@ -292,6 +300,7 @@ namespace HVACControllers {
 			DoWarmRestartFlag( DoWarmRestartFlag ),
 			ReuseIntermediateSolutionFlag( ReuseIntermediateSolutionFlag ),
 			ReusePreviousSolutionFlag( ReusePreviousSolutionFlag ),
+			SeedFromPreviousSolutionFlag( false ),
 			SolutionTrackers( 2, SolutionTrackers ),
 			MaxAvailActuated( MaxAvailActuated ),
 			MaxAvailSensed( MaxAvailSensed ),
@@ -331,12 +340,16 @@ namespace HVACControllers {
 		Array1D_int NumCalls; // Number of times this controller operated in each mode
 		Array1D_int TotIterations; // Total number of iterations required to solve this controller
 		Array1D_int MaxIterations; // Maximum number of iterations required to solve this controller
+		int NumSeededCalls; // Number of active solutions seeded with the previous solution
+		int TotSeededIterations; // Total number of iterations required for the seeded active solutions
 
 		// Default Constructor
 		ControllerStatsType() :
 			NumCalls( {iFirstMode,iLastMode}, 0 ),
 			TotIterations( {iFirstMode,iLastMode}, 0 ),
-			MaxIterations( {iFirstMode,iLastMode}, 0 )
+			MaxIterations( {iFirstMode,iLastMode}, 0 ),
+			NumSeededCalls( 0 ),
+			TotSeededIterations( 0 )
 		{}
 
 		// Member Constructor
@@ -347,7 +360,9 @@ namespace HVACControllers {
 		) :
 			NumCalls( {iFirstMode,iLastMode}, NumCalls ),
 			TotIterations( {iFirstMode,iLastMode}, TotIterations ),
-			MaxIterations( {iFirstMode,iLastMode}, MaxIterations )
+			MaxIterations( {iFirstMode,iLastMode}, MaxIterations ),
+			NumSeededCalls( 0 ),
+			TotSeededIterations( 0 )
 		{}
 
 	};
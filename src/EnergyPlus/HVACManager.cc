@@ -29,6 +29,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -163,6 +164,8 @@ namespace HVACManager {
 		//       AUTHORS:  Russ Taylor, Dan Fisher
 		//       DATE WRITTEN:  Jan. 1998
 		//       MODIFIED       Jul 2003 (CC) added a subroutine call for air models
+		//                      Oct 2026, count zone time steps for the performance log
+		//                      Oct 2026, added TruncationError system timestep control
 		//       RE-ENGINEERED  May 2008, Brent Griffith, revised variable time step method and zone conditions history
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -174,15 +177,21 @@ namespace HVACManager {
 		// METHODOLOGY EMPLOYED:
 		//  manage calls to Predictor and Corrector and other updates in ZoneTempPredictorCorrector
 		//  manage variable time step and when zone air histories are updated.
+		//  the number of system timesteps comes from the change in zone air temperature over the zone
+		//  timestep or, with TruncationError control, from its estimated truncation error.
 
 		// REFERENCES:
 
 		// Using/Aliasing
 		using DataConvergParams::MinTimeStepSys; // =0.0166667     != 1 minute | 0.3 C = (1% OF 300 C) =max allowable diff between ZoneAirTemp at Time=T & T-1
 		using DataConvergParams::MaxZoneTempDiff;
+		using DataConvergParams::SysTimeStepControl;
+		using DataConvergParams::SysTimeStepControlTruncationError;
 
 		using ZoneTempPredictorCorrector::ManageZoneAirUpdates;
 		using ZoneTempPredictorCorrector::DetectOscillatingZoneTemp;
+		using ZoneTempPredictorCorrector::ZoneTempTruncationError;
+		using ZoneTempPredictorCorrector::NumSysTimeStepsForTruncationError;
 
 		using NodeInputManager::CalcMoreNodeInfo;
 		using ZoneEquipmentManager::UpdateZoneSizing;
@@ -228,6 +237,8 @@ namespace HVACManager {
 		using DataGlobals::KindOfSim;
 		using DataGlobals::ksHVACSizeDesignDay;
 		using DataGlobals::ksHVACSizeRunPeriodDesign;
+		using DataTimings::CurrentPhase;
+		using DataTimings::PhaseZoneTimeSteps;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -269,6 +280,8 @@ namespace HVACManager {
 		static gio::Fmt Format_20( "(1x,I3,1x,F8.2,2(2x,F8.3),2x,F8.2,4(1x,F13.2),2x,F8.0,2x,F11.2,2x,F9.5,2x,A)" );
 		static gio::Fmt Format_30( "(1x,I3,5x,A)" );
 
+		++PhaseZoneTimeSteps( CurrentPhase );
+
 		//SYSTEM INITIALIZATION
 		if ( TriggerGetAFN ) {
 			TriggerGetAFN = false;
@@ -362,10 +375,20 @@ namespace HVACManager {
 		ManageZoneAirUpdates( iCorrectStep, ZoneTempChange, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iCorrectStep, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 
-		if ( ZoneTempChange > MaxZoneTempDiff && ! KickOffSimulation ) {
-			//determine value of adaptive system time step
+		if ( KickOffSimulation ) {
+			ZTempTrendsNumSysSteps = 1;
+		} else if ( SysTimeStepControl == SysTimeStepControlTruncationError ) {
+			// shorten the system timestep only as far as needed to bring the estimated truncation error within tolerance
+			ZTempTrendsNumSysSteps = NumSysTimeStepsForTruncationError( ZoneTempTruncationError );
+		} else if ( ZoneTempChange > MaxZoneTempDiff ) {
 			// model how many system timesteps we want in zone timestep
 			ZTempTrendsNumSysSteps = int( ZoneTempChange / MaxZoneTempDiff + 1.0 ); // add 1 for truncation
+		} else {
+			ZTempTrendsNumSysSteps = 1;
+		}
+
+		if ( ZTempTrendsNumSysSteps > 1 ) {
+			//determine value of adaptive system time step
 			NumOfSysTimeSteps = min( ZTempTrendsNumSysSteps, LimitNumSysSteps );
 			//then determine timestep length for even distribution, protect div by zero
 			if ( NumOfSysTimeSteps > 0 ) TimeStepSys = TimeStepZone / NumOfSysTimeSteps;
@@ -558,6 +581,7 @@ namespace HVACManager {
 		//       AUTHOR:          Dan Fisher
 		//       DATE WRITTEN:    April 1997
 		//       DATE MODIFIED:   May 1998 (RKS,RDT)
+		//       MODIFIED         Oct 2026, count iterations for the performance log
 
 		// PURPOSE OF THIS SUBROUTINE: Selects and calls the HVAC loop managers
 
@@ -611,6 +635,10 @@ namespace HVACManager {
 		using PlantUtilities::CheckForRunawayPlantTemps;
 		using PlantUtilities::AnyPlantSplitterMixerLacksContinuity;
 		using DataGlobals::AnyPlantInModel;
+		using DataTimings::CurrentPhase;
+		using DataTimings::PhaseHVACTimeSteps;
+		using DataTimings::PhaseHVACIterations;
+		using DataTimings::PhaseHVACMaxIterations;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -819,6 +847,10 @@ namespace HVACManager {
 			}
 		}
 
+		++PhaseHVACTimeSteps( CurrentPhase );
+		PhaseHVACIterations( CurrentPhase ) += HVACManageIteration;
+		if ( HVACManageIteration > MaxIter ) ++PhaseHVACMaxIterations( CurrentPhase );
+
 		if ( ( HVACManageIteration > MaxIter ) && ( ! WarmupFlag ) ) {
 			++ErrCount;
 			if ( ErrCount < 15 ) {
@@ -133,6 +133,12 @@ namespace HeatBalanceHAMTManager {
 	bool latswitch( false ); // latent heat switch,
 	bool rainswitch( false ); // rain switch,
 
+	// Tridiagonal system for the cells from Extcell to Intcell of one surface
+	Array1D< Real64 > bandsub; // Sub-diagonal coefficients
+	Array1D< Real64 > banddiag; // Diagonal coefficients
+	Array1D< Real64 > bandsup; // Super-diagonal coefficients
+	Array1D< Real64 > bandrhs; // Right hand side, replaced by the solution
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceHAMTManager:
 
 	// Object Data
@@ -660,6 +666,7 @@ namespace HeatBalanceHAMTManager {
 		int adj2;
 		int errorCount;
 		int MaterNum;
+		int maxchain; // Largest number of cells from Extcell to Intcell
 
 		Real64 runor;
 		Real64 high1;
@@ -873,6 +880,19 @@ namespace HeatBalanceHAMTManager {
 
 		}
 
+		// Size the tridiagonal system for the longest chain of solved cells
+		maxchain = 0;
+		for ( sid = 1; sid <= TotSurfaces; ++sid ) {
+			if ( ! Surface( sid ).HeatTransSurf ) continue;
+			if ( Surface( sid ).Class == SurfaceClass_Window ) continue;
+			if ( Surface( sid ).HeatTransferAlgorithm != HeatTransferModel_HAMT ) continue;
+			maxchain = max( maxchain, Intcell( sid ) - Extcell( sid ) + 1 );
+		}
+		bandsub.dimension( maxchain, 0.0 );
+		banddiag.dimension( maxchain, 0.0 );
+		bandsup.dimension( maxchain, 0.0 );
+		bandrhs.dimension( maxchain, 0.0 );
+
 		// Find adjacent cells.
 		for ( cid1 = 1; cid1 <= TotCellsMax; ++cid1 ) {
 			for ( cid2 = 1; cid2 <= TotCellsMax; ++cid2 ) {
@@ -1041,6 +1061,8 @@ namespace HeatBalanceHAMTManager {
 		//unused1208    INTEGER :: cid1
 		int adj;
 		int adjl;
+		int row; // Row of the cell in the tridiagonal system
+		Real64 adjcond; // Moisture conductance to an adjacent cell per unit RH
 
 		//    INTEGER, SAVE :: tempErrCount=0
 		static int qvpErrCount( 0 );
@@ -1189,11 +1211,15 @@ namespace HeatBalanceHAMTManager {
 				}
 			}
 
-			//Calculate Heat and Vapor resistances,
+			//Calculate Heat and Vapor resistances, assembling the heat balance of the cells from
+			//Extcell to Intcell into a tridiagonal system with the properties of this iteration
 			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				row = cid - Extcell( sid ) + 1;
 				torsum = 0.0;
 				oorsum = 0.0;
 				vpdiff = 0.0;
+				bandsub( row ) = 0.0;
+				bandsup( row ) = 0.0;
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
@@ -1233,7 +1259,13 @@ namespace HeatBalanceHAMTManager {
 
 					if ( thermr1 + thermr2 > 0 ) {
 						oorsum += 1.0 / ( thermr1 + thermr2 );
-						torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						if ( adj == cid - 1 && cid > Extcell( sid ) ) {
+							bandsub( row ) = -1.0 / ( thermr1 + thermr2 );
+						} else if ( adj == cid + 1 && cid < Intcell( sid ) ) {
+							bandsup( row ) = -1.0 / ( thermr1 + thermr2 );
+						} else {
+							torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						}
 					}
 					if ( vaporr1 + vaporr2 > 0 ) {
 						vpdiff += ( cells( adj ).vp - cells( cid ).vp ) / ( vaporr1 + vaporr2 );
@@ -1261,8 +1293,14 @@ namespace HeatBalanceHAMTManager {
 					qvp = 0.0;
 				}
 
-				// Calculate the temperature for the next time step
-				cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				banddiag( row ) = oorsum + ( tcap / deltat );
+				bandrhs( row ) = torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat );
+			}
+
+			// Calculate the temperature for the next time step
+			SolveCellBand( Intcell( sid ) - Extcell( sid ) + 1 );
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				cells( cid ).tempp1 = bandrhs( cid - Extcell( sid ) + 1 );
 			}
 
 			//Check for silly temperatures
@@ -1301,12 +1339,16 @@ namespace HeatBalanceHAMTManager {
 				}
 			}
 
-			// Calculate the liquid and vapor resisitances
+			// Calculate the liquid and vapor resisitances, assembling the moisture balance into
+			// the tridiagonal system. The vapor pressure of a neighboring cell is rhp1 * vpsat.
 			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				row = cid - Extcell( sid ) + 1;
 				phioosum = 0.0;
 				phiorsum = 0.0;
 				vpoosum = 0.0;
 				vporsum = 0.0;
+				bandsub( row ) = 0.0;
+				bandsup( row ) = 0.0;
 
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
@@ -1328,10 +1370,6 @@ namespace HeatBalanceHAMTManager {
 					} else {
 						vaporr2 = 0.0;
 					}
-					if ( vaporr1 + vaporr2 > 0 ) {
-						vpoosum += 1.0 / ( vaporr1 + vaporr2 );
-						vporsum += ( cells( adj ).vpp1 / ( vaporr1 + vaporr2 ) );
-					}
 
 					if ( ( cells( cid ).dw > 0 ) && ( cells( cid ).dwdphi > 0 ) ) {
 						rhr1 = cells( cid ).dist( ii ) / ( cells( cid ).overlap( ii ) * cells( cid ).dw * cells( cid ).dwdphi );
@@ -1344,10 +1382,25 @@ namespace HeatBalanceHAMTManager {
 						rhr2 = 0.0;
 					}
 
+					// Conductance to the neighbor per unit of its RH
+					adjcond = 0.0;
+					if ( vaporr1 + vaporr2 > 0 ) {
+						vpoosum += 1.0 / ( vaporr1 + vaporr2 );
+						adjcond += cells( adj ).vpsat / ( vaporr1 + vaporr2 );
+					}
 					//             IF(rhr1+rhr2>0)THEN
 					if ( rhr1 * rhr2 > 0 ) {
 						phioosum += 1.0 / ( rhr1 + rhr2 );
-						phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						adjcond += 1.0 / ( rhr1 + rhr2 );
+					}
+
+					if ( adj == cid - 1 && cid > Extcell( sid ) ) {
+						bandsub( row ) = -adjcond;
+					} else if ( adj == cid + 1 && cid < Intcell( sid ) ) {
+						bandsup( row ) = -adjcond;
+					} else {
+						if ( vaporr1 + vaporr2 > 0 ) vporsum += ( cells( adj ).vpp1 / ( vaporr1 + vaporr2 ) );
+						if ( rhr1 * rhr2 > 0 ) phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
 					}
 
 				}
@@ -1359,16 +1412,22 @@ namespace HeatBalanceHAMTManager {
 					wcap = 0.0;
 				}
 
-				// Calculate the RH for the next time step
+				// Assemble the RH for the next time step
 				denominator = ( phioosum + vpoosum * cells( cid ).vpsat + wcap / deltat );
 				if ( denominator != 0.0 ) {
-					cells( cid ).rhp1 = ( phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat ) / denominator;
+					banddiag( row ) = denominator;
+					bandrhs( row ) = phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat;
 				} else {
 					ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
 					ShowContinueError( "...Problem occurs in Material=\"" + Material( cells( cid ).matid ).Name + "\"." );
 					ShowFatalError( "Program terminates due to preceding condition." );
 				}
+			}
 
+			// Calculate the RH for the next time step
+			SolveCellBand( Intcell( sid ) - Extcell( sid ) + 1 );
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				cells( cid ).rhp1 = bandrhs( cid - Extcell( sid ) + 1 );
 				if ( cells( cid ).rhp1 > rhmax ) {
 					cells( cid ).rhp1 = rhmax;
 				}
@@ -1403,6 +1462,41 @@ namespace HeatBalanceHAMTManager {
 
 	}
 
+	void
+	SolveCellBand( int const n )
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the tridiagonal system held in bandsub, banddiag, bandsup and bandrhs for the
+		// first n rows. The solution replaces bandrhs and banddiag is overwritten.
+
+		// METHODOLOGY EMPLOYED:
+		// Thomas algorithm. The heat and moisture balances of a chain of cells are diagonally
+		// dominant, so no pivoting is needed.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i;
+		Real64 factor;
+
+		// Forward elimination
+		for ( i = 2; i <= n; ++i ) {
+			factor = bandsub( i ) / banddiag( i - 1 );
+			banddiag( i ) -= factor * bandsup( i - 1 );
+			bandrhs( i ) -= factor * bandrhs( i - 1 );
+		}
+
+		// Back substitution
+		bandrhs( n ) /= banddiag( n );
+		for ( i = n - 1; i >= 1; --i ) {
+			bandrhs( i ) = ( bandrhs( i ) - bandsup( i ) * bandrhs( i + 1 ) ) / banddiag( i );
+		}
+	}
+
 	void
 	UpdateHeatBalHAMT( int const sid )
 	{
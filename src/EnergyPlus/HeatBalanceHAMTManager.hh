@@ -57,6 +57,11 @@ namespace HeatBalanceHAMTManager {
 	extern bool latswitch; // latent heat switch,
 	extern bool rainswitch; // rain switch,
 
+	extern Array1D< Real64 > bandsub; // Sub-diagonal coefficients
+	extern Array1D< Real64 > banddiag; // Diagonal coefficients
+	extern Array1D< Real64 > bandsup; // Super-diagonal coefficients
+	extern Array1D< Real64 > bandrhs; // Right hand side, replaced by the solution
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceHAMTManager:
 
 	// Types
@@ -221,6 +226,9 @@ namespace HeatBalanceHAMTManager {
 		Real64 & TempSurfOutTmp
 	);
 
+	void
+	SolveCellBand( int const n );
+
 	void
 	UpdateHeatBalHAMT( int const sid );
 
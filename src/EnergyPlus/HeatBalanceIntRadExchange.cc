@@ -79,6 +79,8 @@ namespace HeatBalanceIntRadExchange {
 	// DERIVED TYPE DEFINITIONS
 	// na
 
+	int const MaxScriptFCacheStates( 4 ); // Shading states per zone whose Script F is kept
+
 	// MODULE VARIABLE DECLARATIONS:
 	int MaxNumOfZoneSurfaces; // Max saved to get large enough space for user input view factors
 
@@ -262,9 +264,14 @@ namespace HeatBalanceIntRadExchange {
 						}
 					}
 
-					CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF );
-					// precalc - multiply by StefanBoltzmannConstant
-					zone_ScriptF *= StefanBoltzmannConst;
+					// Shades and blinds usually toggle between a few states, so reuse the Script F
+					// of a state seen before rather than inverting the matrix again
+					if ( ! GetCachedScriptF( ZoneNum ) ) {
+						CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF );
+						// precalc - multiply by StefanBoltzmannConstant
+						zone_ScriptF *= StefanBoltzmannConst;
+						CacheScriptF( ZoneNum );
+					}
 				}
 
 			} // End of check if SurfIterations = 0
@@ -369,16 +376,24 @@ namespace HeatBalanceIntRadExchange {
 					surface_window.IRfromParentZone += IRfromParentZone_acc / RecSurfEmiss;
 				} else {
 					Real64 netLWRadToRecSurf_acc( 0.0 ); // Local accumulator
-					for ( size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum, ++lSR ) {
-						if ( RecZoneSurfNum != SendZoneSurfNum ) {
 #ifdef EP_HBIRE_SEQ
-							netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
+					// Skip the receiving surface by splitting the row so the inner loops carry no branch
+					Real64 const * const scriptF_row( &zone_ScriptF[ lSR ] ); // [ lSR ] == ( 1, RecZoneSurfNum+1 )
+					for ( size_type SendZoneSurfNum = 0; SendZoneSurfNum < RecZoneSurfNum; ++SendZoneSurfNum ) {
+						netLWRadToRecSurf_acc += scriptF_row[ SendZoneSurfNum ] * ( SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] - RecSurfTempInKTo4th );
+					}
+					for ( size_type SendZoneSurfNum = RecZoneSurfNum + 1; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum ) {
+						netLWRadToRecSurf_acc += scriptF_row[ SendZoneSurfNum ] * ( SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] - RecSurfTempInKTo4th );
+					}
+					lSR += s_zone_Surfaces;
 #else
+					for ( size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum, ++lSR ) {
+						if ( RecZoneSurfNum != SendZoneSurfNum ) {
 							SendSurfNum = zone_SurfacePtr[ SendZoneSurfNum ] - 1;
 							netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
-#endif
 						}
 					}
+#endif
 					netLWRadToRecSurf += netLWRadToRecSurf_acc;
 				}
 			}
@@ -1323,6 +1338,60 @@ namespace HeatBalanceIntRadExchange {
 
 	}
 
+	bool
+	GetCachedScriptF( int const ZoneNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Loads the zone's ScriptF from the cache if it was already calculated for the
+		// zone's current surface emissivities. Returns false if it was not.
+
+		// METHODOLOGY EMPLOYED:
+		// The cache is keyed on the exact emissivities passed to CalcScriptF, so a hit
+		// gives the same ScriptF that recalculating it would.
+
+		auto & zone_info( ZoneInfo( ZoneNum ) );
+
+		for ( int CacheNum = 1; CacheNum <= zone_info.NumScriptFCached; ++CacheNum ) {
+			auto const & cache( zone_info.ScriptFCache( CacheNum ) );
+			if ( ! equal_dimensions( cache.Emissivity, zone_info.Emissivity ) ) continue;
+			if ( ! eq( cache.Emissivity, zone_info.Emissivity ) ) continue;
+			zone_info.ScriptF = cache.ScriptF;
+			return true;
+		}
+		return false;
+
+	}
+
+	void
+	CacheScriptF( int const ZoneNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the zone's ScriptF, already scaled by the Stefan-Boltzmann constant, against
+		// the emissivities it was calculated for.
+
+		// METHODOLOGY EMPLOYED:
+		// Keeps at most MaxScriptFCacheStates entries per zone and overwrites the oldest one
+		// once the cache is full.
+
+		auto & zone_info( ZoneInfo( ZoneNum ) );
+
+		if ( ! allocated( zone_info.ScriptFCache ) ) zone_info.ScriptFCache.allocate( MaxScriptFCacheStates );
+
+		int CacheNum;
+		if ( zone_info.NumScriptFCached < MaxScriptFCacheStates ) {
+			CacheNum = ++zone_info.NumScriptFCached;
+		} else {
+			CacheNum = zone_info.NextScriptFCacheEntry;
+			zone_info.NextScriptFCacheEntry = mod( CacheNum, MaxScriptFCacheStates ) + 1;
+		}
+		auto & cache( zone_info.ScriptFCache( CacheNum ) );
+		cache.Emissivity = zone_info.Emissivity;
+		cache.ScriptF = zone_info.ScriptF;
+
+	}
+
 	void
 	CalcMatrixInverse(
 		Array2< Real64 > & A, // Matrix: Gets reduced to L\U form
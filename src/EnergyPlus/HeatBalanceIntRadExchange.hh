@@ -19,6 +19,7 @@ namespace HeatBalanceIntRadExchange {
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS
+	extern int const MaxScriptFCacheStates; // Shading states per zone whose Script F is kept
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -94,6 +95,12 @@ namespace HeatBalanceIntRadExchange {
 		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
 	);
 
+	bool
+	GetCachedScriptF( int const ZoneNum );
+
+	void
+	CacheScriptF( int const ZoneNum );
+
 	void
 	CalcMatrixInverse(
 		Array2< Real64 > & A, // Matrix: Gets reduced to L\U form
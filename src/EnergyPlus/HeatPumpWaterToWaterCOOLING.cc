@@ -210,6 +210,7 @@ namespace HeatPumpWaterToWaterCOOLING {
 		//       SUBROUTINE INFORMATION:
 		//       AUTHOR:
 		//       DATE WRITTEN:    April 1998
+		//       MODIFIED:        Oct 2026, register the interconnect of the load and source loops
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// This routine will get the input
@@ -233,6 +234,7 @@ namespace HeatPumpWaterToWaterCOOLING {
 		using BranchNodeConnections::TestCompSet;
 		using FluidProperties::FindRefrigerant;
 		using PlantUtilities::RegisterPlantCompDesignFlow;
+		using PlantUtilities::InterConnectTwoPlantLoopSides;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -438,6 +440,9 @@ namespace HeatPumpWaterToWaterCOOLING {
 				ShowFatalError( "GetWatertoWaterHPInput: Program terminated on scan for loop data" );
 			}
 
+			// The load side demands on the source side, which has to be known when the plant loops are grouped
+			InterConnectTwoPlantLoopSides( GSHP( GSHPNum ).LoadLoopNum, GSHP( GSHPNum ).LoadLoopSideNum, GSHP( GSHPNum ).SourceLoopNum, GSHP( GSHPNum ).SourceLoopSideNum, GSHP( GSHPNum ).WWHPPlantTypeOfNum, true );
+
 		}
 
 	}
@@ -223,7 +223,7 @@ namespace HeatPumpWaterToWaterSimple {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Kenneth Tang
 		//       DATE WRITTEN   March 2005
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, register the interconnect of the load and source loops
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -240,6 +240,7 @@ namespace HeatPumpWaterToWaterSimple {
 		using NodeInputManager::GetOnlySingleNode;
 		using BranchNodeConnections::TestCompSet;
 		using PlantUtilities::RegisterPlantCompDesignFlow;
+		using PlantUtilities::InterConnectTwoPlantLoopSides;
 		using DataPlant::TypeOf_HPWaterEFCooling;
 		using DataPlant::TypeOf_HPWaterEFHeating;
 		using DataPlant::ScanPlantLoopsForObject;
@@ -413,6 +414,9 @@ namespace HeatPumpWaterToWaterSimple {
 				ShowFatalError( "GetWatertoWaterHPInput: Program terminated on scan for loop data" );
 			}
 
+			// The load side demands on the source side, which has to be known when the plant loops are grouped
+			InterConnectTwoPlantLoopSides( GSHP( GSHPNum ).LoadLoopNum, GSHP( GSHPNum ).LoadLoopSideNum, GSHP( GSHPNum ).SourceLoopNum, GSHP( GSHPNum ).SourceLoopSideNum, GSHP( GSHPNum ).WWHPPlantTypeOfNum, true );
+
 		}
 
 	}
@@ -1,6 +1,8 @@
 // C++ Headers
 #include <algorithm>
+#include <fstream>
 #include <istream>
+#include <sstream>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Backspace.hh>
@@ -80,7 +82,7 @@ namespace InputProcessor {
 	// when max is reached
 	int const SectionsIDFAllocInc( 20 ); // Initial number of Sections allowed in IDF as well as the increment
 	// when max is reached
-	int const ObjectsIDFAllocInc( 500 ); // Initial number of Objects allowed in IDF as well as the increment
+	int const ObjectsIDFAllocInc( 500 ); // Initial number of Objects allowed in IDF (doubled each time it is reached)
 	// when max is reached
 	std::string::size_type const MaxObjectNameLength( MaxNameLength ); // Maximum number of characters in an Object Name
 	std::string::size_type const MaxSectionNameLength( MaxNameLength ); // Maximum number of characters in a Section Name
@@ -128,6 +130,9 @@ namespace InputProcessor {
 	int MinimumNumberOfFields( 0 ); // When ReadLine discovers a "minimum" number of fields for an object, this variable is set
 	int NumObsoleteObjects( 0 ); // Number of \obsolete objects
 	int TotalAuditErrors( 0 ); // Counting some warnings that go onto only the audit file
+	int LastGotObjectDef( 0 ); // Object definition of the last item returned by GetObjectItem
+	int LastGotObjectNumber( 0 ); // Item number of the last item returned by GetObjectItem
+	int LastGotObjectRecord( 0 ); // IDF record of the last item returned by GetObjectItem
 	int NumSecretObjects( 0 ); // Number of objects in "Secret Mode"
 	bool ProcessingIDD( false ); // True when processing IDD, false when processing IDF
 	std::ostream * echo_stream( nullptr ); // Internal stream used for input file echoing (used for performance)
@@ -258,15 +263,20 @@ namespace InputProcessor {
 			ShowFatalError( "ProcessInput: Could not open file " + outputIperrFileName + " for output (write)." );
 		}
 
-		std::ifstream idd_stream( inputIddFileName, std::ios_base::in | std::ios_base::binary );
-		if ( ! idd_stream ) {
-			if ( idd_stream.is_open() ) idd_stream.close();
+		std::ifstream idd_file( inputIddFileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! idd_file ) {
+			if ( idd_file.is_open() ) idd_file.close();
 			if ( ! gio::file_exists( inputIddFileName ) ) { // No such file
 				ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + inputIddFileName );
 			} else {
 				ShowFatalError( "ProcessInput: Could not open file \"" + inputIddFileName + "\" for input (read)." );
 			}
 		}
+		// The data dictionary is parsed from memory: each object definition ends by backing up a line,
+		// which on a file stream is a series of single character seeks and buffer refills.
+		std::stringstream idd_stream;
+		idd_stream << idd_file.rdbuf();
+		idd_file.close();
 		NumLines = 0;
 
 		DoingInputProcessing = true;
@@ -274,7 +284,6 @@ namespace InputProcessor {
 		DisplayString( "Processing Data Dictionary" );
 		ProcessingIDD = true;
 		ProcessDataDicFile( idd_stream, ErrorsInIDD );
-		idd_stream.close();
 
 		ListOfObjects.allocate( NumObjectDefs );
 		ListOfObjects = ObjectDef( {1,NumObjectDefs} ).Name();
@@ -1119,6 +1128,9 @@ namespace InputProcessor {
 
 		MaxIDFRecords = ObjectsIDFAllocInc;
 		NumIDFRecords = 0;
+		LastGotObjectDef = 0;
+		LastGotObjectNumber = 0;
+		LastGotObjectRecord = 0;
 		MaxIDFSections = SectionsIDFAllocInc;
 		NumIDFSections = 0;
 
@@ -1154,7 +1166,9 @@ namespace InputProcessor {
 				} else {
 					ValidateObjectandParse( idf_stream, InputLine.substr( 0, Pos ), Pos, EndofFile );
 					if ( NumIDFRecords == MaxIDFRecords ) {
-						IDFRecords.redimension( MaxIDFRecords += ObjectsIDFAllocInc );
+						// Grow geometrically: each redimension copies every record gotten so far (including their
+						// field arrays), so a fixed increment makes reading large files quadratic.
+						IDFRecords.redimension( MaxIDFRecords *= 2 );
 					}
 				}
 			} else { // Error condition, no , or ; on first line
@@ -2235,10 +2249,21 @@ namespace InputProcessor {
 		}
 		++ObjectGotCount( Found );
 
+		// Objects are almost always gotten in sequence (1, 2, 3, ...), so when the item after the last one
+		// returned is requested, continue the search from that record instead of rescanning from the start.
+		if ( Found == LastGotObjectDef && Number == LastGotObjectNumber + 1 && LastGotObjectRecord > 0 ) {
+			StartRecord = LastGotObjectRecord + 1;
+			Count = LastGotObjectNumber;
+		}
+		LastGotObjectDef = 0;
+
 		for ( LoopIndex = StartRecord; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
 			if ( IDFRecords( LoopIndex ).Name == UCObject ) {
 				++Count;
 				if ( Count == Number ) {
+					LastGotObjectDef = Found;
+					LastGotObjectNumber = Number;
+					LastGotObjectRecord = LoopIndex;
 					IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
 					// Read this one
 					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
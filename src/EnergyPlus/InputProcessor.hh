@@ -31,7 +31,7 @@ namespace InputProcessor {
 	// when max is reached
 	extern int const SectionsIDFAllocInc; // Initial number of Sections allowed in IDF as well as the increment
 	// when max is reached
-	extern int const ObjectsIDFAllocInc; // Initial number of Objects allowed in IDF as well as the increment
+	extern int const ObjectsIDFAllocInc; // Initial number of Objects allowed in IDF (doubled each time it is reached)
 	// when max is reached
 	extern std::string::size_type const MaxObjectNameLength; // Maximum number of characters in an Object Name
 	extern std::string::size_type const MaxSectionNameLength; // Maximum number of characters in a Section Name
@@ -75,6 +75,9 @@ namespace InputProcessor {
 	extern int MinimumNumberOfFields; // When ReadLine discovers a "minimum" number of fields for an object, this variable is set
 	extern int NumObsoleteObjects; // Number of \obsolete objects
 	extern int TotalAuditErrors; // Counting some warnings that go onto only the audit file
+	extern int LastGotObjectDef; // Object definition of the last item returned by GetObjectItem
+	extern int LastGotObjectNumber; // Item number of the last item returned by GetObjectItem
+	extern int LastGotObjectRecord; // IDF record of the last item returned by GetObjectItem
 	extern int NumSecretObjects; // Number of objects in "Secret Mode"
 	extern bool ProcessingIDD; // True when processing IDD, false when processing IDF
 	extern std::ostream * echo_stream; // Internal stream used for input file echoing (used for performance)
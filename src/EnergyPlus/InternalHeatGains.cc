@@ -4428,16 +4428,40 @@ namespace InternalHeatGains {
 		}
 
 		// store pointer values to hold generic internal gain values constant for entire timestep
+		// and sum them over the zone's devices for the SumAll... routines
 		for ( NZ = 1; NZ <= NumOfZones; ++NZ ) {
-			for ( Loop = 1; Loop <= ZoneIntGain( NZ ).NumberOfDevices; ++Loop ) {
-				ZoneIntGain( NZ ).Device( Loop ).ConvectGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrConvectGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).ReturnAirConvGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrReturnAirConvGainRate;
-				if ( DoRadiationUpdate ) ZoneIntGain( NZ ).Device( Loop ).RadiantGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrRadiantGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).LatentGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrLatentGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).ReturnAirLatentGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrReturnAirLatentGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).CarbonDioxideGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrCarbonDioxideGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).GenericContamGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrGenericContamGainRate;
+			auto & zone_gain( ZoneIntGain( NZ ) );
+			Real64 SumConvGainRate( 0.0 );
+			Real64 SumReturnAirConvGainRate( 0.0 );
+			Real64 SumRadiantGainRate( 0.0 );
+			Real64 SumLatentGainRate( 0.0 );
+			Real64 SumReturnAirLatentGainRate( 0.0 );
+			Real64 SumCarbonDioxideGainRate( 0.0 );
+			Real64 SumGenericContamGainRate( 0.0 );
+			for ( Loop = 1; Loop <= zone_gain.NumberOfDevices; ++Loop ) {
+				auto & device( zone_gain.Device( Loop ) );
+				device.ConvectGainRate = device.PtrConvectGainRate;
+				device.ReturnAirConvGainRate = device.PtrReturnAirConvGainRate;
+				if ( DoRadiationUpdate ) device.RadiantGainRate = device.PtrRadiantGainRate;
+				device.LatentGainRate = device.PtrLatentGainRate;
+				device.ReturnAirLatentGainRate = device.PtrReturnAirLatentGainRate;
+				device.CarbonDioxideGainRate = device.PtrCarbonDioxideGainRate;
+				device.GenericContamGainRate = device.PtrGenericContamGainRate;
+				SumConvGainRate += device.ConvectGainRate;
+				SumReturnAirConvGainRate += device.ReturnAirConvGainRate;
+				SumRadiantGainRate += device.RadiantGainRate;
+				SumLatentGainRate += device.LatentGainRate;
+				SumReturnAirLatentGainRate += device.ReturnAirLatentGainRate;
+				SumCarbonDioxideGainRate += device.CarbonDioxideGainRate;
+				SumGenericContamGainRate += device.GenericContamGainRate;
 			}
+			zone_gain.SumConvGainRate = SumConvGainRate;
+			zone_gain.SumReturnAirConvGainRate = SumReturnAirConvGainRate;
+			zone_gain.SumRadiantGainRate = SumRadiantGainRate;
+			zone_gain.SumLatentGainRate = SumLatentGainRate;
+			zone_gain.SumReturnAirLatentGainRate = SumReturnAirLatentGainRate;
+			zone_gain.SumCarbonDioxideGainRate = SumCarbonDioxideGainRate;
+			zone_gain.SumGenericContamGainRate = SumGenericContamGainRate;
 			if ( ReSumLatentGains ) {
 				SumAllInternalLatentGains( NZ, ZoneLatentGain( NZ ) );
 			}
@@ -4462,14 +4486,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum stored by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone total is summed once when the device values are stored for the timestep.
 
 		// REFERENCES:
 		// na
@@ -4490,21 +4514,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumConvGainRate;
-		int DeviceNum;
-
-		tmpSumConvGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumConvGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumConvGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ConvectGainRate;
-		}
+		// na
 
-		SumConvGainRate = tmpSumConvGainRate;
+		SumConvGainRate = ZoneIntGain( ZoneNum ).SumConvGainRate;
 
 	}
 
@@ -4586,14 +4598,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum stored by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone total is summed once when the device values are stored for the timestep.
 
 		// REFERENCES:
 		// na
@@ -4614,21 +4626,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumRetAirGainRate;
-		int DeviceNum;
-
-		tmpSumRetAirGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumReturnAirGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumRetAirGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirConvGainRate;
-		}
+		// na
 
-		SumReturnAirGainRate = tmpSumRetAirGainRate;
+		SumReturnAirGainRate = ZoneIntGain( ZoneNum ).SumReturnAirConvGainRate;
 
 	}
 
@@ -4710,14 +4710,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum stored by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone total is summed once when the device values are stored for the timestep.
 
 		// REFERENCES:
 		// na
@@ -4738,21 +4738,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumRadGainRate;
-		int DeviceNum;
-
-		tmpSumRadGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumRadGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumRadGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).RadiantGainRate;
-		}
+		// na
 
-		SumRadGainRate = tmpSumRadGainRate;
+		SumRadGainRate = ZoneIntGain( ZoneNum ).SumRadiantGainRate;
 
 	}
 
@@ -4834,14 +4822,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum stored by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone total is summed once when the device values are stored for the timestep.
 
 		// REFERENCES:
 		// na
@@ -4862,21 +4850,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumLatentGainRate;
-		int DeviceNum;
-
-		tmpSumLatentGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumLatentGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).LatentGainRate;
-		}
+		// na
 
-		SumLatentGainRate = tmpSumLatentGainRate;
+		SumLatentGainRate = ZoneIntGain( ZoneNum ).SumLatentGainRate;
 
 	}
 
@@ -4958,14 +4934,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum stored by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone total is summed once when the device values are stored for the timestep.
 
 		// REFERENCES:
 		// na
@@ -4986,21 +4962,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumLatentGainRate;
-		int DeviceNum;
-
-		tmpSumLatentGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumRetAirLatentGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirLatentGainRate;
-		}
+		// na
 
-		SumRetAirLatentGainRate = tmpSumLatentGainRate;
+		SumRetAirLatentGainRate = ZoneIntGain( ZoneNum ).SumReturnAirLatentGainRate;
 
 	}
 
@@ -5014,14 +4978,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum stored by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone total is summed once when the device values are stored for the timestep.
 
 		// REFERENCES:
 		// na
@@ -5042,21 +5006,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumCO2GainRate;
-		int DeviceNum;
-
-		tmpSumCO2GainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumCO2GainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumCO2GainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).CarbonDioxideGainRate;
-		}
+		// na
 
-		SumCO2GainRate = tmpSumCO2GainRate;
+		SumCO2GainRate = ZoneIntGain( ZoneNum ).SumCarbonDioxideGainRate;
 
 	}
 
@@ -5138,14 +5090,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         L. Gu
 		//       DATE WRITTEN   Feb. 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum stored by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types based on the existing subrotine SumAllInternalCO2Gains
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone total is summed once when the device values are stored for the timestep.
 
 		// REFERENCES:
 		// na
@@ -5166,21 +5118,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumGCGainRate;
-		int DeviceNum;
-
-		tmpSumGCGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumGCGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumGCGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).GenericContamGainRate;
-		}
+		// na
 
-		SumGCGainRate = tmpSumGCGainRate;
+		SumGCGainRate = ZoneIntGain( ZoneNum ).SumGenericContamGainRate;
 
 	}
 
@@ -1075,6 +1075,7 @@ namespace NodeInputManager {
 		static Array1D_int NodeDewPointSchedPtr;
 		static std::vector<std::string> nodeReportingStrings;
 		static std::vector<std::string> nodeFluidNames;
+		static Array1D< Real64 > GlycolRhoStd; // density at InitConvTemp by glycol index (0.0 until first needed)
 		bool ReportWetBulb;
 		bool ReportRelHumidity;
 		bool ReportDewPoint;
@@ -1126,6 +1127,10 @@ namespace NodeInputManager {
 			MyOneTimeFlag = false;
 		}
 
+		// the standard density only depends on the fluid, so it is evaluated once per glycol
+		// rather than once per water node every time step
+		if ( isize( GlycolRhoStd ) < NumOfGlycols ) GlycolRhoStd.dimension( NumOfGlycols, 0.0 );
+
 		for ( iNode = 1; iNode <= NumOfNodes; ++iNode ) {
 			ReportWetBulb = false;
 			ReportRelHumidity = false;
@@ -1185,7 +1190,11 @@ namespace NodeInputManager {
 					Cp = CPCW( Node( iNode ).Temp );
 				} else {
 					Cp = GetSpecificHeatGlycol( nodeFluidNames[iNode - 1], Node( iNode ).Temp, Node( iNode ).FluidIndex, nodeReportingStrings[iNode - 1] );
-					rhoStd = GetDensityGlycol( nodeFluidNames[iNode - 1], InitConvTemp, Node( iNode ).FluidIndex, nodeReportingStrings[iNode - 1] );
+					rhoStd = GlycolRhoStd( Node( iNode ).FluidIndex );
+					if ( rhoStd == 0.0 ) {
+						rhoStd = GetDensityGlycol( nodeFluidNames[iNode - 1], InitConvTemp, Node( iNode ).FluidIndex, nodeReportingStrings[iNode - 1] );
+						GlycolRhoStd( Node( iNode ).FluidIndex ) = rhoStd;
+					}
 					rho = GetDensityGlycol( nodeFluidNames[iNode - 1], Node( iNode ).Temp, Node( iNode ).FluidIndex, nodeReportingStrings[iNode - 1] );
 				}
 
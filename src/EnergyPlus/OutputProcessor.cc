@@ -7,6 +7,7 @@
 #include <fstream>
 #include <ostream>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -2819,6 +2820,61 @@ namespace OutputProcessor {
 
 	}
 
+	void
+	UpdateMeterValues(
+		Real64 const TimeStepValue, // Value of this variable at the current time step.
+		MeterArrayType const & VarMeterArray // Meters and custom meters this variable is "on"
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda Lawrie
+		//       DATE WRITTEN   January 2001
+		//       MODIFIED       Oct 2026, take the variable's meter array directly
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine updates all the meter values in the lists with the current
+		// time step value for this variable.
+
+		// METHODOLOGY EMPLOYED:
+		// Same as the array argument version above, but walks the on meter and on custom
+		// meter lists of the variable in place.  This is called for every metered variable
+		// on every zone time step, so it avoids building array slices and optional
+		// arguments for each call.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Meter; // Loop Control
+
+		for ( Meter = 1; Meter <= VarMeterArray.NumOnMeters; ++Meter ) {
+			MeterValue( VarMeterArray.OnMeters( Meter ) ) += TimeStepValue;
+		}
+
+		// This calculates the basic values for decrement/difference meters -- UpdateMeters then calculates the actual.
+		for ( Meter = 1; Meter <= VarMeterArray.NumOnCustomMeters; ++Meter ) {
+			MeterValue( VarMeterArray.OnCustomMeters( Meter ) ) += TimeStepValue;
+		}
+
+	}
+
 	void
 	UpdateMeters( int const TimeStamp ) // Current TimeStamp (for max/min)
 	{
@@ -2859,27 +2915,23 @@ namespace OutputProcessor {
 		int Meter; // Loop Control
 
 		for ( Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
-			if ( EnergyMeters( Meter ).TypeOfMeter != MeterType_CustomDec && EnergyMeters( Meter ).TypeOfMeter != MeterType_CustomDiff ) {
-				EnergyMeters( Meter ).TSValue += MeterValue( Meter );
-				EnergyMeters( Meter ).HRValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).HRMaxVal, EnergyMeters( Meter ).HRMaxValDate, EnergyMeters( Meter ).HRMinVal, EnergyMeters( Meter ).HRMinValDate );
-				EnergyMeters( Meter ).DYValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).DYMaxVal, EnergyMeters( Meter ).DYMaxValDate, EnergyMeters( Meter ).DYMinVal, EnergyMeters( Meter ).DYMinValDate );
-				EnergyMeters( Meter ).MNValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).MNMaxVal, EnergyMeters( Meter ).MNMaxValDate, EnergyMeters( Meter ).MNMinVal, EnergyMeters( Meter ).MNMinValDate );
-				EnergyMeters( Meter ).SMValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).SMMaxVal, EnergyMeters( Meter ).SMMaxValDate, EnergyMeters( Meter ).SMMinVal, EnergyMeters( Meter ).SMMinValDate );
+			auto & meter( EnergyMeters( Meter ) );
+			Real64 Increment; // Amount added to the hour...run period values
+			if ( meter.TypeOfMeter != MeterType_CustomDec && meter.TypeOfMeter != MeterType_CustomDiff ) {
+				Increment = MeterValue( Meter );
+				meter.TSValue += Increment;
 			} else {
-				EnergyMeters( Meter ).TSValue = EnergyMeters( EnergyMeters( Meter ).SourceMeter ).TSValue - MeterValue( Meter );
-				EnergyMeters( Meter ).HRValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).HRMaxVal, EnergyMeters( Meter ).HRMaxValDate, EnergyMeters( Meter ).HRMinVal, EnergyMeters( Meter ).HRMinValDate );
-				EnergyMeters( Meter ).DYValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).DYMaxVal, EnergyMeters( Meter ).DYMaxValDate, EnergyMeters( Meter ).DYMinVal, EnergyMeters( Meter ).DYMinValDate );
-				EnergyMeters( Meter ).MNValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).MNMaxVal, EnergyMeters( Meter ).MNMaxValDate, EnergyMeters( Meter ).MNMinVal, EnergyMeters( Meter ).MNMinValDate );
-				EnergyMeters( Meter ).SMValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).SMMaxVal, EnergyMeters( Meter ).SMMaxValDate, EnergyMeters( Meter ).SMMinVal, EnergyMeters( Meter ).SMMinValDate );
+				meter.TSValue = EnergyMeters( meter.SourceMeter ).TSValue - MeterValue( Meter );
+				Increment = meter.TSValue;
 			}
+			meter.HRValue += Increment;
+			SetMinMax( meter.TSValue, TimeStamp, meter.HRMaxVal, meter.HRMaxValDate, meter.HRMinVal, meter.HRMinValDate );
+			meter.DYValue += Increment;
+			SetMinMax( meter.TSValue, TimeStamp, meter.DYMaxVal, meter.DYMaxValDate, meter.DYMinVal, meter.DYMinValDate );
+			meter.MNValue += Increment;
+			SetMinMax( meter.TSValue, TimeStamp, meter.MNMaxVal, meter.MNMaxValDate, meter.MNMinVal, meter.MNMinValDate );
+			meter.SMValue += Increment;
+			SetMinMax( meter.TSValue, TimeStamp, meter.SMMaxVal, meter.SMMaxValDate, meter.SMMinVal, meter.SMMinValDate );
 		}
 
 		MeterValue = 0.0; // Ready for next update
@@ -5509,12 +5561,40 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	static Real64 LEndMin( -1.0 ); // Helps set minutes for timestamp output
 	static bool EndTimeStepFlag( false ); // True when it's the end of the Zone Time Step
 	Real64 rxTime; // (MinuteNow-StartMinute)/REAL(MinutesPerTimeStep,r64) - for execution time
+	static std::vector< int > RVariableLoops[ 3 ]; // RVariableTypes entries of each index type (1=Zone, 2=HVAC)
+	static std::vector< int > IVariableLoops[ 3 ]; // IVariableTypes entries of each index type (1=Zone, 2=HVAC)
+	static int NumOfRVariableLooped( 0 ); // NumOfRVariable when RVariableLoops was built
+	static int NumOfIVariableLooped( 0 ); // NumOfIVariable when IVariableLoops was built
 
 	IndexType = IndexTypeKey;
 	if ( IndexType != ZoneTSReporting && IndexType != HVACTSReporting ) {
 		ShowFatalError( "Invalid reporting requested -- UpdateDataAndReport" );
 	}
 
+	// Variables can still be added after the simulation starts, so the lists of variables of each index type
+	// are rebuilt whenever the number of variables changes.  These lists spare the per time step loops from
+	// scanning (and skipping) every variable of the other index type.
+	if ( NumOfRVariable != NumOfRVariableLooped ) {
+		RVariableLoops[ ZoneVar ].clear();
+		RVariableLoops[ HVACVar ].clear();
+		for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+			if ( RVariableTypes( Loop ).IndexType == ZoneVar || RVariableTypes( Loop ).IndexType == HVACVar ) {
+				RVariableLoops[ RVariableTypes( Loop ).IndexType ].push_back( Loop );
+			}
+		}
+		NumOfRVariableLooped = NumOfRVariable;
+	}
+	if ( NumOfIVariable != NumOfIVariableLooped ) {
+		IVariableLoops[ ZoneVar ].clear();
+		IVariableLoops[ HVACVar ].clear();
+		for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
+			if ( IVariableTypes( Loop ).IndexType == ZoneVar || IVariableTypes( Loop ).IndexType == HVACVar ) {
+				IVariableLoops[ IVariableTypes( Loop ).IndexType ].push_back( Loop );
+			}
+		}
+		NumOfIVariableLooped = NumOfIVariable;
+	}
+
 	if ( ( IndexType >= ZoneVar ) && ( IndexType <= HVACVar ) ) {
 
 		// Basic record keeping and report out if "detailed"
@@ -5536,11 +5616,10 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		rxTime = ( MinuteNow - StartMinute ) / double( MinutesPerTimeStep );
 
 		// Main "Record Keeping" Loops for R and I variables
-		for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-			if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+		for ( int const RLoop : RVariableLoops[ IndexType ] ) {
 
 			// Act on the RVariables variable using the RVar structure
-			RVar >>= RVariableTypes( Loop ).VarPtr;
+			RVar >>= RVariableTypes( RLoop ).VarPtr;
 			auto & rVar( RVar() );
 			rVar.Stored = true;
 			if ( rVar.StoreType == AveragedVar ) {
@@ -5602,11 +5681,10 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			}
 		}
 
-		for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-			if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
+		for ( int const ILoop : IVariableLoops[ IndexType ] ) {
 
 			// Act on the IVariables variable using the IVar structure
-			IVar >>= IVariableTypes( Loop ).VarPtr;
+			IVar >>= IVariableTypes( ILoop ).VarPtr;
 			auto & iVar( IVar() );
 			iVar.Stored = true;
 			//      ICurVal=IVar%Which
@@ -5676,17 +5754,12 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	if ( EndTimeStepFlag ) {
 
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
-				RVar >>= RVariableTypes( Loop ).VarPtr;
+			for ( int const RLoop : RVariableLoops[ IndexType ] ) {
+				RVar >>= RVariableTypes( RLoop ).VarPtr;
 				auto & rVar( RVar() );
 				// Update meters on the TimeStep  (Zone)
 				if ( rVar.MeterArrayPtr != 0 ) {
-					if ( VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters <= 0 ) {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters );
-					} else {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters, VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnCustomMeters );
-					}
+					UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ) );
 				}
 				ReportNow = true;
 				if ( rVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( rVar.SchedPtr ) != 0.0 ); //SetReportNow(RVar%SchedPtr)
@@ -5723,9 +5796,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.thisTSStored = false;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
-				IVar >>= IVariableTypes( Loop ).VarPtr;
+			for ( int const ILoop : IVariableLoops[ IndexType ] ) {
+				IVar >>= IVariableTypes( ILoop ).VarPtr;
 				auto & iVar( IVar() );
 				ReportNow = true;
 				if ( iVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( iVar.SchedPtr ) != 0.0 ); // SetReportNow(IVar%SchedPtr)
@@ -5781,9 +5853,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
 			TimeValue( IndexType ).CurMinute = 0.0;
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
-				RVar >>= RVariableTypes( Loop ).VarPtr;
+			for ( int const RLoop : RVariableLoops[ IndexType ] ) {
+				RVar >>= RVariableTypes( RLoop ).VarPtr;
 				auto & rVar( RVar() );
 				//        ReportNow=.TRUE.
 				//        IF (RVar%SchedPtr > 0) &
@@ -5808,9 +5879,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.Value = 0.0;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
-				IVar >>= IVariableTypes( Loop ).VarPtr;
+			for ( int const ILoop : IVariableLoops[ IndexType ] ) {
+				IVar >>= IVariableTypes( ILoop ).VarPtr;
 				auto & iVar( IVar() );
 				//        ReportNow=.TRUE.
 				//        IF (IVar%SchedPtr > 0) &
@@ -1076,6 +1076,12 @@ namespace OutputProcessor {
 		Optional< Array1S_int const > OnCustomMeters = _ // Which custom meters this variable is on (index values)
 	);
 
+	void
+	UpdateMeterValues(
+		Real64 const TimeStepValue, // Value of this variable at the current time step.
+		MeterArrayType const & VarMeterArray // Meters and custom meters this variable is "on"
+	);
+
 	void
 	UpdateMeters( int const TimeStamp ); // Current TimeStamp (for max/min)
 
@@ -3448,6 +3448,9 @@ namespace OutputReportTabular {
 			curTypeOfVar = OutputTableBinned( iInObj ).typeOfVar;
 			curStepType = OutputTableBinned( iInObj ).stepType;
 			curScheduleIndex = OutputTableBinned( iInObj ).scheduleIndex;
+			// only objects of the step type being reported are gathered, so skip the others
+			// before looking up their schedule
+			if ( ! ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) ) continue;
 			//if a schedule was used, check if it was non-zero value
 			if ( curScheduleIndex != 0 ) {
 				if ( GetCurrentScheduleValue( curScheduleIndex ) != 0.0 ) {
@@ -3461,42 +3464,40 @@ namespace OutputReportTabular {
 			if ( gatherThisTime ) {
 				for ( jTable = 1; jTable <= curNumTables; ++jTable ) {
 					repIndex = curResIndex + ( jTable - 1 );
-					if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-						// put actual value from OutputProcesser arrays
-						curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( IndexTypeKey == HVACTSReporting ) {
-							elapsedTime = TimeStepSys;
-						} else {
-							elapsedTime = TimeStepZone;
-						}
-						if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
-							curValue /= ( elapsedTime * SecInHour );
-						}
-						// check if the value is above the maximum or below the minimum value
-						// first before binning the value within the range.
-						if ( curValue < curIntervalStart ) {
-							BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else if ( curValue >= topValue ) {
-							BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else {
-							// determine which bin the results are in
-							binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
-							BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
-							BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
-						}
-						// add to statistics array
-						++BinStatistics( repIndex ).n;
-						BinStatistics( repIndex ).sum += curValue;
-						BinStatistics( repIndex ).sum2 += curValue * curValue;
-						if ( curValue < BinStatistics( repIndex ).minimum ) {
-							BinStatistics( repIndex ).minimum = curValue;
-						}
-						if ( curValue > BinStatistics( repIndex ).maximum ) {
-							BinStatistics( repIndex ).maximum = curValue;
-						}
+					// put actual value from OutputProcesser arrays
+					curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
+					// per MJW when a summed variable is used divide it by the length of the time step
+					if ( IndexTypeKey == HVACTSReporting ) {
+						elapsedTime = TimeStepSys;
+					} else {
+						elapsedTime = TimeStepZone;
+					}
+					if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
+						curValue /= ( elapsedTime * SecInHour );
+					}
+					// check if the value is above the maximum or below the minimum value
+					// first before binning the value within the range.
+					if ( curValue < curIntervalStart ) {
+						BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
+						BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
+					} else if ( curValue >= topValue ) {
+						BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
+						BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
+					} else {
+						// determine which bin the results are in
+						binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
+						BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
+						BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
+					}
+					// add to statistics array
+					++BinStatistics( repIndex ).n;
+					BinStatistics( repIndex ).sum += curValue;
+					BinStatistics( repIndex ).sum2 += curValue * curValue;
+					if ( curValue < BinStatistics( repIndex ).minimum ) {
+						BinStatistics( repIndex ).minimum = curValue;
+					}
+					if ( curValue > BinStatistics( repIndex ).maximum ) {
+						BinStatistics( repIndex ).maximum = curValue;
 					}
 				}
 			}
@@ -3570,7 +3571,10 @@ namespace OutputReportTabular {
 		static Array1D_int MonthlyColumnsAggType;
 		static Array1D_int MonthlyColumnsVarNum;
 		static Array1D_int MonthlyTablesNumColumns;
+		static Array1D_bool MonthlyTablesHasZoneStep;
+		static Array1D_bool MonthlyTablesHasHVACStep;
 		static int curFirstColumn( 0 );
+		int gatherStepType; // step type of the columns gathered on this call
 
 		if ( ! DoWeathSim ) return;
 
@@ -3583,6 +3587,18 @@ namespace OutputReportTabular {
 			MonthlyColumnsVarNum = MonthlyColumns.varNum();
 			//MonthlyTables
 			MonthlyTablesNumColumns = MonthlyTables.numColumns();
+			//flag the tables that contain any columns of each step type so
+			//tables without a matching column are skipped without scanning them
+			MonthlyTablesHasZoneStep.dimension( MonthlyTablesCount, false );
+			MonthlyTablesHasHVACStep.dimension( MonthlyTablesCount, false );
+			for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+				curFirstColumn = MonthlyTables( iTable ).firstColumn;
+				for ( jColumn = 1; jColumn <= MonthlyTablesNumColumns( iTable ); ++jColumn ) {
+					curCol = jColumn + curFirstColumn - 1;
+					if ( MonthlyColumnsStepType( curCol ) == stepTypeZone ) MonthlyTablesHasZoneStep( iTable ) = true;
+					if ( MonthlyColumnsStepType( curCol ) == stepTypeHVAC ) MonthlyTablesHasHVACStep( iTable ) = true;
+				}
+			}
 
 			//set flag so this block is only executed once
 			RunOnce = false;
@@ -3594,16 +3610,29 @@ namespace OutputReportTabular {
 		} else {
 			elapsedTime = TimeStepZone;
 		}
+		if ( IndexTypeKey == ZoneTSReporting ) {
+			gatherStepType = stepTypeZone;
+		} else if ( IndexTypeKey == HVACTSReporting ) {
+			gatherStepType = stepTypeHVAC;
+		} else {
+			gatherStepType = 0;
+		}
+		// the current timestamp is the same for every column gathered on this call
+		minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
+		EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
 		IsMonthGathered( Month ) = true;
+		if ( gatherStepType == 0 ) return;
 		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+			if ( gatherStepType == stepTypeZone && ! MonthlyTablesHasZoneStep( iTable ) ) continue;
+			if ( gatherStepType == stepTypeHVAC && ! MonthlyTablesHasHVACStep( iTable ) ) continue;
 			activeMinMax = false; //at the beginning of the new timestep
 			activeHoursShown = false; //fix by JG addressing CR6482
 			curFirstColumn = MonthlyTables( iTable ).firstColumn;
 			for ( jColumn = 1; jColumn <= MonthlyTablesNumColumns( iTable ); ++jColumn ) {
 				curCol = jColumn + curFirstColumn - 1;
-				curTypeOfVar = MonthlyColumnsTypeOfVar( curCol );
 				curStepType = MonthlyColumnsStepType( curCol );
-				if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
+				if ( curStepType == gatherStepType ) {
+					curTypeOfVar = MonthlyColumnsTypeOfVar( curCol );
 					//  the above condition used to include the following prior to new scan method
 					//  (MonthlyColumns(curCol)%aggType .EQ. aggTypeValueWhenMaxMin)
 					curVarNum = MonthlyColumnsVarNum( curCol );
@@ -3617,12 +3646,6 @@ namespace OutputReportTabular {
 					newTimeStamp = 0;
 					newDuration = 0.0;
 					activeNewValue = false;
-					// the current timestamp
-					minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
-					//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
-					//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
-					//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
-					EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
 					// perform the selected aggregation type
 					// use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
 					{ auto const SELECT_CASE_var( MonthlyColumnsAggType( curCol ) );
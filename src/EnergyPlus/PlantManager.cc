@@ -122,7 +122,7 @@ namespace PlantManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Sankaranarayanan K P
 		//       DATE WRITTEN   Apr 2005
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, iterate each group of interconnected loops separately
 		//       RE-ENGINEERED  B. Griffith, Feb. 2010
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -132,6 +132,8 @@ namespace PlantManager {
 		// Set up the while iteration block for the plant loop simulation.
 		// Calls half loop sides to be simulated in predetermined order.
 		// Reset the flags as necessary
+		// Each group of interconnected loops (see SetupPlantLoopGroups) has its own iteration block,
+		// so loops that have converged are not held up by unrelated loops.
 
 		// REFERENCES:
 		// na
@@ -150,80 +152,108 @@ namespace PlantManager {
 
 		// SUBROUTINE VARIABLE DEFINITIONS
 		int IterPlant;
+		int MaxIterPlant; // Largest number of sub iterations of any loop group
 		int LoopNum;
 		int LoopSide;
 		int LoopSideNum;
 		int OtherSide;
 		bool SimHalfLoopFlag;
+		bool SimGroupLoops; // True when some part of the current loop group needs to be (re)simulated
 		int HalfLoopNum;
+		int GroupNum;
+		int GroupHalfLoopNum;
 		int CurntMinPlantSubIterations;
 
-		if ( any_eq( PlantLoop.CommonPipeType(), CommonPipe_Single ) || any_eq( PlantLoop.CommonPipeType(), CommonPipe_TwoWay ) ) {
-			CurntMinPlantSubIterations = max( 7, MinPlantSubIterations );
-		} else {
-			CurntMinPlantSubIterations = MinPlantSubIterations;
-		}
-
 		if ( TotNumLoops <= 0 ) { // quick return if no plant in model
 			SimPlantLoops = false;
 			return;
 		}
 
-		IterPlant = 0;
 		InitializeLoops( FirstHVACIteration );
+		if ( NumPlantLoopGroups == 0 ) SetupPlantLoopGroups();
 
-		while ( ( SimPlantLoops ) && ( IterPlant <= MaxPlantSubIterations ) ) {
-			// go through half loops in predetermined calling order
-			for ( HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+		// Loops in different groups have no interconnect, so each group is iterated to convergence on its own.
+		// The half loops of a group are called in the same order as in the full calling order.
+		MaxIterPlant = 0;
+		for ( GroupNum = 1; GroupNum <= NumPlantLoopGroups; ++GroupNum ) {
+			auto const & this_group( PlantLoopGroup( GroupNum ) );
 
-				LoopNum = PlantCallingOrderInfo( HalfLoopNum ).LoopIndex;
-				LoopSide = PlantCallingOrderInfo( HalfLoopNum ).LoopSide;
-				OtherSide = 3 - LoopSide; //will give us 1 if LoopSide is 2, or 2 if LoopSide is 1
+			if ( this_group.HasCommonPipe ) {
+				CurntMinPlantSubIterations = max( 7, MinPlantSubIterations );
+			} else {
+				CurntMinPlantSubIterations = MinPlantSubIterations;
+			}
+
+			IterPlant = 0;
+			SimGroupLoops = SimPlantLoops;
+
+			while ( ( SimGroupLoops ) && ( IterPlant <= MaxPlantSubIterations ) ) {
+				// go through half loops of this group in predetermined calling order
+				for ( GroupHalfLoopNum = 1; GroupHalfLoopNum <= isize( this_group.CallingOrderIndex ); ++GroupHalfLoopNum ) {
+
+					HalfLoopNum = this_group.CallingOrderIndex( GroupHalfLoopNum );
+					LoopNum = PlantCallingOrderInfo( HalfLoopNum ).LoopIndex;
+					LoopSide = PlantCallingOrderInfo( HalfLoopNum ).LoopSide;
+					OtherSide = 3 - LoopSide; //will give us 1 if LoopSide is 2, or 2 if LoopSide is 1
 
-				auto & this_loop( PlantLoop( LoopNum ) );
-				auto & this_loop_side( this_loop.LoopSide( LoopSide ) );
-				auto & other_loop_side( this_loop.LoopSide( OtherSide ) );
+					auto & this_loop( PlantLoop( LoopNum ) );
+					auto & this_loop_side( this_loop.LoopSide( LoopSide ) );
+					auto & other_loop_side( this_loop.LoopSide( OtherSide ) );
 
-				SimHalfLoopFlag = this_loop_side.SimLoopSideNeeded; //set half loop sim flag
+					SimHalfLoopFlag = this_loop_side.SimLoopSideNeeded; //set half loop sim flag
 
-				if ( SimHalfLoopFlag || IterPlant <= CurntMinPlantSubIterations ) {
+					if ( SimHalfLoopFlag || IterPlant <= CurntMinPlantSubIterations ) {
 
-					PlantHalfLoopSolver( FirstHVACIteration, LoopSide, LoopNum, other_loop_side.SimLoopSideNeeded );
+						PlantHalfLoopSolver( FirstHVACIteration, LoopSide, LoopNum, other_loop_side.SimLoopSideNeeded );
 
-					// Always set this side to false,  so that it won't keep being turned on just because of first hvac
-					this_loop_side.SimLoopSideNeeded = false;
+						// Always set this side to false,  so that it won't keep being turned on just because of first hvac
+						this_loop_side.SimLoopSideNeeded = false;
 
-					// If we did the demand side, turn on the supply side (only if we need to do it last)
-					if ( LoopSide == DemandSide ) {
-						if ( this_loop.HasPressureComponents ) {
-							other_loop_side.SimLoopSideNeeded = false;
+						// If we did the demand side, turn on the supply side (only if we need to do it last)
+						if ( LoopSide == DemandSide ) {
+							if ( this_loop.HasPressureComponents ) {
+								other_loop_side.SimLoopSideNeeded = false;
+							}
 						}
+
+						// Update the report variable
+						PlantReport( LoopNum ).LastLoopSideSimulated = LoopSide;
+
+						++PlantManageHalfLoopCalls;
 					}
 
-					// Update the report variable
-					PlantReport( LoopNum ).LastLoopSideSimulated = LoopSide;
+				} // half loop based calling order...
 
-					++PlantManageHalfLoopCalls;
+				// decide new status for SimGroupLoops flag
+				SimGroupLoops = false;
+				for ( GroupHalfLoopNum = 1; GroupHalfLoopNum <= isize( this_group.CallingOrderIndex ); ++GroupHalfLoopNum ) {
+					HalfLoopNum = this_group.CallingOrderIndex( GroupHalfLoopNum );
+					if ( PlantLoop( PlantCallingOrderInfo( HalfLoopNum ).LoopIndex ).LoopSide( PlantCallingOrderInfo( HalfLoopNum ).LoopSide ).SimLoopSideNeeded ) {
+						SimGroupLoops = true;
+						break;
+					}
 				}
 
-			} // half loop based calling order...
+				++IterPlant; // Increment the iteration counter
+				if ( IterPlant < CurntMinPlantSubIterations ) SimGroupLoops = true;
+			} //while
 
-			// decide new status for SimPlantLoops flag
-			SimPlantLoops = false;
-			for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
-				for ( LoopSideNum = 1; LoopSideNum <= 2; ++LoopSideNum ) {
-					if ( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).SimLoopSideNeeded ) {
-						SimPlantLoops = true;
-						goto LoopLevel_exit;
-					}
+			MaxIterPlant = max( MaxIterPlant, IterPlant );
+		} // loop groups
+
+		PlantManageSubIterations += MaxIterPlant; // these are summed across all half loops for reporting
+
+		// decide new status for SimPlantLoops flag
+		SimPlantLoops = false;
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			for ( LoopSideNum = 1; LoopSideNum <= 2; ++LoopSideNum ) {
+				if ( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).SimLoopSideNeeded ) {
+					SimPlantLoops = true;
+					goto LoopLevel_exit;
 				}
 			}
-			LoopLevel_exit: ;
-
-			++IterPlant; // Increment the iteration counter
-			if ( IterPlant < CurntMinPlantSubIterations ) SimPlantLoops = true;
-			++PlantManageSubIterations; // these are summed across all half loops for reporting
-		} //while
+		}
+		LoopLevel_exit: ;
 
 		// add check for non-plant system sim flag updates
 		//  could set SimAirLoops, SimElecCircuits, SimZoneEquipment flags for now
@@ -2134,6 +2164,7 @@ namespace PlantManager {
 				// have now called each plant component model at least once with InitLoopEquip = .TRUE.
 				//  this means the calls to InterConnectTwoPlantLoopSides have now been made, so rework calling order
 				RevisePlantCallingOrder();
+				SetupPlantLoopGroups();
 
 				// Step 4: Simulate plant loop components so their design flows are included
 
@@ -3631,6 +3662,118 @@ namespace PlantManager {
 		return CallingIndex;
 	}
 
+	void
+	SetupPlantLoopGroups()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Split the plant and condenser loops into groups of loops that are interconnected
+		// through components, directly or through other loops. ManagePlantLoops() iterates
+		// each group to convergence on its own, so every component that couples two loops has to
+		// register the interconnect when the plant equipment is first initialized.
+
+		// METHODOLOGY EMPLOYED:
+		// The loop side interconnects recorded by InterConnectTwoPlantLoopSides() are the edges of
+		// a graph on the loops. Each loop is labelled with the lowest loop number it is connected to,
+		// repeating until no label changes. Groups are numbered in the order their first half loop
+		// appears in PlantCallingOrderInfo, and each group keeps the calling order of its half loops.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D_int LoopLabel; // Lowest loop number connected to each loop
+		Array1D_int LoopGroupNum; // Group number of each loop
+		Array1D_int GroupNumHalfLoops; // Number of half loops in each group
+		int HalfLoopNum;
+		int LoopNum;
+		int LoopSideNum;
+		int ConnctNum;
+		int OtherLoopNum;
+		int GroupNum;
+		bool LabelChanged;
+
+		NumPlantLoopGroups = 0;
+		PlantLoopGroup.deallocate();
+		if ( TotNumHalfLoops <= 0 ) return;
+
+		LoopLabel.allocate( TotNumLoops );
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			LoopLabel( LoopNum ) = LoopNum;
+		}
+
+		LabelChanged = true;
+		while ( LabelChanged ) {
+			LabelChanged = false;
+			for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+				for ( LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+					auto const & this_loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+					if ( ! allocated( this_loop_side.Connected ) ) continue;
+					for ( ConnctNum = 1; ConnctNum <= isize( this_loop_side.Connected ); ++ConnctNum ) {
+						OtherLoopNum = this_loop_side.Connected( ConnctNum ).LoopNum;
+						if ( OtherLoopNum < 1 || OtherLoopNum > TotNumLoops ) continue;
+						if ( LoopLabel( OtherLoopNum ) < LoopLabel( LoopNum ) ) {
+							LoopLabel( LoopNum ) = LoopLabel( OtherLoopNum );
+							LabelChanged = true;
+						} else if ( LoopLabel( LoopNum ) < LoopLabel( OtherLoopNum ) ) {
+							LoopLabel( OtherLoopNum ) = LoopLabel( LoopNum );
+							LabelChanged = true;
+						}
+					}
+				}
+			}
+		}
+
+		// Number the groups in calling order, and count their half loops
+		LoopGroupNum.dimension( TotNumLoops, 0 );
+		GroupNumHalfLoops.dimension( TotNumLoops, 0 );
+		for ( HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+			LoopNum = PlantCallingOrderInfo( HalfLoopNum ).LoopIndex;
+			if ( LoopGroupNum( LoopLabel( LoopNum ) ) == 0 ) {
+				++NumPlantLoopGroups;
+				LoopGroupNum( LoopLabel( LoopNum ) ) = NumPlantLoopGroups;
+			}
+			++GroupNumHalfLoops( LoopGroupNum( LoopLabel( LoopNum ) ) );
+		}
+
+		PlantLoopGroup.allocate( NumPlantLoopGroups );
+		for ( GroupNum = 1; GroupNum <= NumPlantLoopGroups; ++GroupNum ) {
+			PlantLoopGroup( GroupNum ).CallingOrderIndex.allocate( GroupNumHalfLoops( GroupNum ) );
+			GroupNumHalfLoops( GroupNum ) = 0;
+		}
+		for ( HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+			LoopNum = PlantCallingOrderInfo( HalfLoopNum ).LoopIndex;
+			auto & this_group( PlantLoopGroup( LoopGroupNum( LoopLabel( LoopNum ) ) ) );
+			this_group.CallingOrderIndex( ++GroupNumHalfLoops( LoopGroupNum( LoopLabel( LoopNum ) ) ) ) = HalfLoopNum;
+			if ( PlantLoop( LoopNum ).CommonPipeType == CommonPipe_Single || PlantLoop( LoopNum ).CommonPipeType == CommonPipe_TwoWay ) {
+				this_group.HasCommonPipe = true;
+			}
+		}
+
+	}
+
 	void
 	StoreAPumpOnCurrentTempLoop(
 		int const LoopNum,
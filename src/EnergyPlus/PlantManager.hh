@@ -284,6 +284,9 @@ namespace PlantManager {
 	void
 	RevisePlantCallingOrder();
 
+	void
+	SetupPlantLoopGroups();
+
 	int
 	FindLoopSideInCallingOrder(
 		int const LoopNum,
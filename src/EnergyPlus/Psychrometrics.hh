@@ -352,10 +352,13 @@ namespace Psychrometrics {
 		// see PsyHFnTdbW ref. to ASHRAE Fundamentals
 		// USAGE:  cpa = PsyCpAirFnWTdb(w,T)
 
-		// Static locals
+		// Static locals (one set per thread with OpenMP)
 		static Real64 dwSave( -100.0 );
 		static Real64 Tsave( -100.0 );
 		static Real64 cpaSave( -100.0 );
+#ifdef _OPENMP
+#pragma omp threadprivate( dwSave, Tsave, cpaSave )
+#endif
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -382,10 +385,13 @@ namespace Psychrometrics {
 		// Faster version with humidity ratio already adjusted
 		assert( dw >= 1.0e-5 );
 
-		// Static locals
+		// Static locals (one set per thread with OpenMP)
 		static Real64 dwSave( -100.0 );
 		static Real64 Tsave( -100.0 );
 		static Real64 cpaSave( -100.0 );
+#ifdef _OPENMP
+#pragma omp threadprivate( dwSave, Tsave, cpaSave )
+#endif
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -0,0 +1,798 @@
+// C++ Headers
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/stream.functions.hh>
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <ReadVars.hh>
+#include <DisplayRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace ReadVars {
+
+	// Module containing the routines that turn eso/mtr output into csv columns
+
+	// MODULE INFORMATION:
+	//       AUTHOR         Linda Lawrie (ReadVarsESO)
+	//       DATE WRITTEN   1998
+	//       MODIFIED       na
+	//       RE-ENGINEERED  Oct 2026, moved into EnergyPlus from the stand-alone ReadVarsESO program
+
+	// PURPOSE OF THIS MODULE:
+	// This module collates the report variable (eso) or meter (mtr) output into one column
+	// per variable and one row per reporting interval, as the ReadVarsESO program does, so
+	// that the --readvars option does not have to start a separate program for each file.
+
+	// METHODOLOGY EMPLOYED:
+	// The rvi/mvi file names the input file, the output file and the variables to extract
+	// (by report number or by name, with "~" to exclude).  With no variables listed, all
+	// variables in the input file are extracted.  The data dictionary is read to set up the
+	// columns, then the data is read once and each row is written as soon as its time
+	// stamp is complete, so only the current row is held in memory.
+
+	// REFERENCES:
+	// src/ReadVars/ReadVarsESO.f90
+
+	// OTHER NOTES:
+	// The frequency selection and the 255 column limit of ReadVarsESO are not supported;
+	// EnergyPlus always ran it as "unlimited" for all frequencies.
+
+	// USE STATEMENTS:
+	// na
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	// na
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// MODULE VARIABLE DECLARATIONS:
+	// na
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE ReadVars
+
+	// Functions
+
+	void
+	ProcessVariableFile(
+		std::string const & VarFileName, // rvi/mvi file naming the input, output and variables to extract
+		std::string const & AuditFileName // Audit file to append processing notes to
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda Lawrie (ReadVarsESO)
+		//       DATE WRITTEN   1998
+		//       MODIFIED       na
+		//       RE-ENGINEERED  Oct 2026
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine produces the csv file described by one rvi/mvi file.
+
+		// METHODOLOGY EMPLOYED:
+		// Same selection and collation rules as ReadVarsESO.  Variables requested by name are
+		// matched exactly on a first pass through the data dictionary; names that did not
+		// match exactly are matched as partial ("wildcard") names on a second pass.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const EndOfDictionary( "End of Data Dictionary" );
+		static std::string const EndOfData( "End of Data" );
+		static std::string const MonthNames[ 12 ] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string Line;
+		std::string InputFileName; // eso or mtr file
+		std::string OutputFileName; // csv, tab or txt file
+		char Separator( ',' );
+		bool GetVarsFromESO( false ); // True when all variables (except ignored ones) are extracted
+		bool GotInputFileName( false );
+		bool GotOutputFileName( false );
+		std::string::size_type Pos;
+		std::vector< int > TrackNum; // Report numbers of the columns
+		std::vector< std::string > TrackVar; // Headings of the columns
+		std::vector< bool > TrackFound; // True when the column was found in the data dictionary
+		std::vector< int > IgnoreNum; // Report numbers to exclude
+		std::vector< std::string > FindVar; // Names to extract
+		std::vector< int > FindVarProcessed; // Number of matches of each name (negative when a partial name)
+		std::vector< std::string > IgnoreFindVar; // Names to exclude
+		std::vector< int > StoNum; // Report numbers matched by name, in dictionary order
+		std::vector< std::string > StoVar; // Headings of variables matched by name
+		int MaxRptNum( -1 ); // Largest report number in the data dictionary
+
+		std::ofstream audit_stream( AuditFileName, std::ios_base::out | std::ios_base::app );
+		audit_stream << " ReadVars\n";
+
+		std::ifstream rvi_stream( VarFileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! rvi_stream ) {
+			DisplayString( "Requested Report Variable input file=" + VarFileName );
+			DisplayString( "does not exist.  Check eplusout.err file for possible explanations." );
+			audit_stream << " Requested Report Variable input file=" << VarFileName << '\n';
+			audit_stream << " does not exist.  Check eplusout.err file for possible explanations.\n";
+			return;
+		}
+		audit_stream << " processing:" << VarFileName << '\n';
+
+		// Input file name is the first non-comment line, output file name the second
+		while ( ! GotInputFileName ) {
+			if ( ! cross_platform_get_line( rvi_stream, Line ) ) {
+				audit_stream << " reached end of rvi file while looking for input file name\n";
+				InputFileName = "eplusout.eso";
+				OutputFileName = "eplusout.csv";
+				GetVarsFromESO = true;
+				GotOutputFileName = true;
+				break;
+			}
+			InputFileName = stripped( Line );
+			if ( has_prefix( InputFileName, "!" ) ) {
+				audit_stream << " ignoring comment line=" << InputFileName << '\n';
+				continue;
+			}
+			Pos = InputFileName.find( '!' );
+			if ( Pos != std::string::npos ) {
+				audit_stream << "comment stripped on line:" << InputFileName << '\n';
+				InputFileName = stripped( InputFileName.substr( 0, Pos ) );
+			}
+			GotInputFileName = true;
+		}
+		if ( InputFileName.empty() ) InputFileName = "eplusout.eso";
+
+		std::ifstream eso_stream( InputFileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! eso_stream ) {
+			DisplayString( "Requested ESO file=" + InputFileName );
+			DisplayString( "does not exist.  ReadVars terminated." );
+			audit_stream << " Requested ESO file=" << InputFileName << '\n';
+			audit_stream << " does not exist.  ReadVars terminated.\n";
+			return;
+		}
+		audit_stream << " input file:" << InputFileName << '\n';
+
+		while ( ! GotOutputFileName ) {
+			if ( ! cross_platform_get_line( rvi_stream, Line ) ) Line.clear();
+			OutputFileName = stripped( Line );
+			if ( has_prefix( OutputFileName, "!" ) ) {
+				audit_stream << " ignoring comment line=" << OutputFileName << '\n';
+				continue;
+			}
+			Pos = OutputFileName.find( '!' );
+			if ( Pos != std::string::npos ) {
+				audit_stream << "comment stripped on line:" << OutputFileName << '\n';
+				OutputFileName = stripped( OutputFileName.substr( 0, Pos ) );
+			}
+			GotOutputFileName = true;
+		}
+		if ( OutputFileName.empty() ) {
+			OutputFileName = "eplusout.csv";
+		} else if ( OutputFileName.length() >= 3 ) {
+			std::string const FileExtension( uppercased( OutputFileName.substr( OutputFileName.length() - 3 ) ) );
+			if ( FileExtension == "TAB" ) {
+				Separator = '\t';
+			} else if ( FileExtension == "TXT" ) {
+				Separator = ' ';
+			}
+		}
+
+		std::ofstream csv_stream( OutputFileName, std::ios_base::out | std::ios_base::trunc );
+		if ( ! csv_stream ) {
+			DisplayString( "Output file=" + OutputFileName );
+			DisplayString( "cannot be opened.  It may be open in another program." );
+			audit_stream << " Output file=" << OutputFileName << '\n';
+			audit_stream << " cannot be opened.  It may be open in another program.\n";
+			return;
+		}
+		audit_stream << " output file:" << OutputFileName << '\n';
+
+		// Variable selections: report numbers or names, "~" to exclude, ended by a blank line or 0
+		if ( ! GetVarsFromESO ) {
+			bool Done( false );
+			bool AnyLine( false );
+			while ( ! Done && cross_platform_get_line( rvi_stream, Line ) ) {
+				std::replace( Line.begin(), Line.end(), '\t', ' ' );
+				Line = stripped( Line );
+				if ( ! AnyLine ) {
+					AnyLine = true;
+					if ( Line.empty() || Line == "0" ) {
+						GetVarsFromESO = true;
+						break;
+					}
+				}
+				Pos = Line.find( '!' );
+				if ( Pos == 0 ) {
+					audit_stream << " ignoring comment line=" << Line << '\n';
+					continue;
+				} else if ( Pos != std::string::npos ) {
+					audit_stream << " stripping comment from line=" << Line << '\n';
+					Line = trimmed( Line.substr( 0, Pos ) );
+				}
+				bool const IgnoreThisOne( has_prefix( Line, "~" ) );
+				int VarNum( -999 );
+				if ( Line.find( ',' ) == std::string::npos ) {
+					VarNum = ProcessVarNumber( IgnoreThisOne ? Line.substr( 1 ) : Line );
+				}
+				if ( Line.empty() ) VarNum = 0;
+				if ( VarNum > 0 ) {
+					if ( IgnoreThisOne ) {
+						IgnoreNum.push_back( VarNum );
+					} else {
+						TrackNum.push_back( VarNum );
+					}
+				} else if ( VarNum < 0 ) {
+					// Name, up to any units; blanks after a key name comma are dropped
+					std::string VarName( IgnoreThisOne ? Line.substr( 1 ) : Line );
+					Pos = VarName.find( '[' );
+					if ( Pos != std::string::npos ) VarName.erase( Pos );
+					VarName = trimmed( lstripped( VarName ) );
+					Pos = VarName.find( ',' );
+					if ( Pos != std::string::npos ) {
+						VarName = VarName.substr( 0, Pos + 1 ) + lstripped( VarName.substr( Pos + 1 ) );
+					}
+					if ( IgnoreThisOne ) {
+						IgnoreFindVar.push_back( VarName );
+					} else {
+						FindVar.push_back( VarName );
+						FindVarProcessed.push_back( 0 );
+					}
+				} else {
+					Done = true;
+				}
+			}
+			if ( ! AnyLine ) GetVarsFromESO = true;
+			if ( ! GetVarsFromESO ) {
+				if ( TrackNum.empty() && FindVar.empty() && IgnoreNum.empty() && IgnoreFindVar.empty() ) {
+					DisplayString( "You chose no variables" );
+					audit_stream << " You chose no variables\n";
+					return;
+				}
+				if ( TrackNum.empty() && FindVar.empty() ) GetVarsFromESO = true;
+			}
+		}
+		TrackVar.resize( TrackNum.size() );
+		TrackFound.resize( TrackNum.size(), false );
+
+		if ( GetVarsFromESO ) {
+			audit_stream << " getting all vars from:" << InputFileName << '\n';
+		}
+
+		// Names are matched case insensitively against upper cased dictionary lines
+		std::vector< std::string > IgnoreFindVarUC;
+		for ( auto const & IgnoreName : IgnoreFindVar ) IgnoreFindVarUC.push_back( uppercased( IgnoreName ) );
+		std::vector< std::string > FindVarUC;
+		for ( auto const & Name : FindVar ) FindVarUC.push_back( uppercased( Name ) );
+		bool const MatchNames( ! IgnoreFindVarUC.empty() || ( ! GetVarsFromESO && ! FindVarUC.empty() ) );
+		std::string LineUC;
+
+		// Data dictionary (twice when selecting by name: exact names first, then partial names)
+		int const NumPasses( GetVarsFromESO ? 1 : 2 );
+		for ( int Pass = 1; Pass <= NumPasses; ++Pass ) {
+			eso_stream.clear();
+			eso_stream.seekg( 0, std::ios::beg );
+			cross_platform_get_line( eso_stream, Line );
+			int const NumToSkip( has( Line, "Program Version" ) ? 6 : 5 ); // Standard time stamp definitions
+			for ( int Skip = 1; Skip <= NumToSkip; ++Skip ) {
+				if ( ! cross_platform_get_line( eso_stream, Line ) ) break;
+			}
+			while ( eso_stream && trimmed( Line ) != EndOfDictionary ) {
+				Pos = Line.find( ',' );
+				if ( Pos == std::string::npos ) break;
+				int const RptNum( std::atoi( Line.substr( 0, Pos ).c_str() ) );
+				MaxRptNum = std::max( MaxRptNum, RptNum );
+				if ( MatchNames ) LineUC = uppercased( Line );
+
+				bool Ignore( std::find( IgnoreNum.begin(), IgnoreNum.end(), RptNum ) != IgnoreNum.end() );
+				for ( auto const & IgnoreNameUC : IgnoreFindVarUC ) {
+					if ( Ignore ) break;
+					Ignore = ( LineUC.find( IgnoreNameUC ) != std::string::npos );
+				}
+
+				if ( Ignore ) {
+				} else if ( GetVarsFromESO ) {
+					TrackNum.push_back( RptNum );
+					TrackVar.push_back( VariableHeading( Line ) );
+					TrackFound.push_back( true );
+				} else {
+					for ( std::vector< std::string >::size_type Find = 0; Find < FindVar.size(); ++Find ) {
+						if ( Pass == 2 && FindVarProcessed[ Find ] > 0 ) continue;
+						std::string::size_type K( LineUC.find( FindVarUC[ Find ] ) );
+						if ( K != std::string::npos && ( K == 0 || Line[ K - 1 ] != ',' ) ) K = std::string::npos;
+						if ( K != std::string::npos && Pass == 1 ) {
+							// Must be exactly the variable (up to the units or frequency)
+							std::string::size_type KPos( Line.find( '[', K ) );
+							if ( KPos == std::string::npos ) KPos = Line.find( '!', K );
+							if ( KPos != std::string::npos && ! equali( FindVar[ Find ], trimmed( Line.substr( K, KPos - K ) ) ) ) K = std::string::npos;
+						}
+						if ( K == std::string::npos ) continue;
+						if ( Pass == 1 ) ++FindVarProcessed[ Find ];
+						if ( std::find( TrackNum.begin(), TrackNum.end(), RptNum ) != TrackNum.end() ) break;
+						if ( std::find( StoNum.begin(), StoNum.end(), RptNum ) != StoNum.end() ) break;
+						if ( Pass == 2 ) --FindVarProcessed[ Find ];
+						StoNum.push_back( RptNum );
+						StoVar.push_back( VariableHeading( Line ) );
+						break;
+					}
+					for ( std::vector< int >::size_type Track = 0; Track < TrackNum.size(); ++Track ) {
+						if ( TrackNum[ Track ] != RptNum ) continue;
+						TrackFound[ Track ] = true;
+						TrackVar[ Track ] = VariableHeading( Line );
+					}
+				}
+
+				cross_platform_get_line( eso_stream, Line );
+			}
+			if ( ! eso_stream ) {
+				DisplayString( "EOF encountered during read of ESO header records" );
+				DisplayString( "probable EnergyPlus error condition -- check eplusout.err" );
+				audit_stream << " EOF encountered during read of ESO header records\n";
+				audit_stream << " probable EnergyPlus error condition -- check eplusout.err\n";
+				return;
+			}
+		}
+
+		// Columns requested by name follow the numbered ones, in the order the names were given
+		for ( int NamePass = 1; NamePass <= 2; ++NamePass ) {
+			for ( auto & Name : FindVar ) {
+				Pos = Name.find( ',' );
+				if ( NamePass == 1 ) {
+					if ( Pos == std::string::npos ) continue;
+				} else if ( Pos != std::string::npos ) {
+					Name[ Pos ] = ':';
+				}
+				for ( std::vector< int >::size_type Sto = 0; Sto < StoNum.size(); ++Sto ) {
+					if ( StoVar[ Sto ].empty() ) continue;
+					if ( FindNoCase( StoVar[ Sto ], Name ) == std::string::npos ) continue;
+					TrackNum.push_back( StoNum[ Sto ] );
+					TrackVar.push_back( StoVar[ Sto ] );
+					TrackFound.push_back( true );
+					StoNum[ Sto ] = 0;
+					StoVar[ Sto ].clear();
+				}
+			}
+		}
+
+		// Only variables found in the data dictionary become columns
+		std::vector< int >::size_type NumTrack( 0 );
+		for ( std::vector< int >::size_type Track = 0; Track < TrackNum.size(); ++Track ) {
+			if ( TrackFound[ Track ] ) {
+				TrackNum[ NumTrack ] = TrackNum[ Track ];
+				TrackVar[ NumTrack ] = TrackVar[ Track ];
+				++NumTrack;
+			} else {
+				DisplayString( "variable =" + std::to_string( TrackNum[ Track ] ) + " not found" );
+				audit_stream << " variable =" << TrackNum[ Track ] << " not found\n";
+			}
+		}
+		TrackNum.resize( NumTrack );
+		TrackVar.resize( NumTrack );
+		audit_stream << " number variables requested for output=" << NumTrack << '\n';
+
+		std::vector< int > TrackIndex( std::max( MaxRptNum, 0 ) + 1, -1 ); // Column of each report number
+		for ( std::vector< int >::size_type Track = 0; Track < NumTrack; ++Track ) {
+			if ( TrackNum[ Track ] >= 0 && TrackNum[ Track ] <= MaxRptNum ) TrackIndex[ TrackNum[ Track ] ] = static_cast< int >( Track );
+		}
+		std::vector< std::string > OutData( NumTrack );
+		std::vector< bool > OutFound( NumTrack, false );
+
+		// Header line
+		csv_stream << "Date/Time";
+		for ( auto const & Heading : TrackVar ) {
+			csv_stream << Separator << Heading;
+		}
+		csv_stream << " \n";
+
+		// Collate the data into rows
+		std::string CurDate; // Time step/hourly label
+		std::string CurMonDay; // Daily label
+		std::string CurMon; // Monthly label
+		std::string CurPer; // Run period label
+		bool NoDetails( true ); // No time step/hourly data seen
+		bool NoMonDay( true ); // No daily data seen
+		bool NoMon( true ); // No monthly data seen
+		int HourOfDay( 0 );
+		Real64 EndMinute( 0.0 );
+		std::vector< Real64 > Fields;
+		char LabelBuffer[ 64 ];
+
+		cross_platform_get_line( eso_stream, Line ); // First environment line
+		while ( true ) {
+			if ( ! cross_platform_get_line( eso_stream, Line ) ) {
+				DisplayString( "EOF encountered on eplusout.eso while reading data" );
+				DisplayString( "probable EnergyPlus error condition -- check eplusout.err" );
+				audit_stream << " EOF encountered on eplusout.eso while reading data\n";
+				audit_stream << " probable EnergyPlus error condition -- check eplusout.err\n";
+				break;
+			}
+			if ( trimmed( Line ) == EndOfData ) {
+				if ( ! NoDetails ) {
+					WriteDataRow( csv_stream, CurDate, Separator, OutData, OutFound );
+				} else if ( ! NoMonDay ) {
+					WriteDataRow( csv_stream, CurMonDay, Separator, OutData, OutFound );
+				} else if ( ! NoMon ) {
+					WriteDataRow( csv_stream, CurMon, Separator, OutData, OutFound );
+				} else {
+					WriteDataRow( csv_stream, CurPer, Separator, OutData, OutFound );
+				}
+				audit_stream << " ReadVars completed successfully.\n";
+				break;
+			}
+			if ( is_blank( Line ) ) {
+				DisplayString( "Output file=" + OutputFileName + " error occured during processing." );
+				DisplayString( "Blank line in middle of processing.  Likely fatal error during EnergyPlus execution." );
+				audit_stream << " Output file=" << OutputFileName << '\n';
+				audit_stream << " error occured during processing.\n";
+				audit_stream << " Blank line in middle of processing.\n";
+				break;
+			}
+			Pos = Line.find( ',' );
+			int const LineNo( Pos == std::string::npos ? 0 : std::atoi( Line.substr( 0, Pos ).c_str() ) );
+			bool ErrorInLine( LineNo <= 0 );
+
+			if ( LineNo == 1 ) { // Environment line
+
+			} else if ( LineNo == 2 ) { // Date/Hour line
+				NoDetails = false;
+				ErrorInLine = ! ReadStampFields( Line, 8, Fields );
+				if ( ! ErrorInLine ) {
+					int const NewHourOfDay( static_cast< int >( Fields[ 5 ] ) );
+					Real64 const NewEndMinute( Fields[ 7 ] );
+					if ( ! CurDate.empty() && ( NewHourOfDay != HourOfDay || NewEndMinute != EndMinute ) ) {
+						WriteDataRow( csv_stream, CurDate, Separator, OutData, OutFound );
+					}
+					HourOfDay = NewHourOfDay;
+					EndMinute = NewEndMinute;
+					int CurHr( HourOfDay - 1 );
+					int CurMin( static_cast< int >( EndMinute ) );
+					int const CurSec( static_cast< int >( ( EndMinute - CurMin ) * 60.0 ) );
+					if ( EndMinute == 60.0 ) {
+						CurHr = HourOfDay;
+						CurMin = 0;
+					}
+					std::snprintf( LabelBuffer, sizeof( LabelBuffer ), " %02d/%02d  %02d:%02d:%02d", static_cast< int >( Fields[ 2 ] ), static_cast< int >( Fields[ 3 ] ), CurHr, CurMin, CurSec );
+					CurDate = LabelBuffer;
+				}
+
+			} else if ( LineNo == 3 ) { // Month/day (daily)
+				if ( NoDetails ) {
+					NoMonDay = false;
+					ErrorInLine = ! ReadStampFields( Line, 5, Fields );
+					if ( ! ErrorInLine ) {
+						if ( ! CurMonDay.empty() ) WriteDataRow( csv_stream, CurMonDay, Separator, OutData, OutFound );
+						std::snprintf( LabelBuffer, sizeof( LabelBuffer ), " %02d/%02d", static_cast< int >( Fields[ 2 ] ), static_cast< int >( Fields[ 3 ] ) );
+						CurMonDay = LabelBuffer;
+					}
+				}
+
+			} else if ( LineNo == 4 ) { // Month (monthly)
+				if ( NoDetails && NoMonDay ) {
+					NoMon = false;
+					ErrorInLine = ! ReadStampFields( Line, 3, Fields );
+					if ( ! ErrorInLine ) {
+						int const Month( static_cast< int >( Fields[ 2 ] ) );
+						ErrorInLine = ( Month < 1 || Month > 12 );
+						if ( ! ErrorInLine ) {
+							if ( ! CurMon.empty() ) WriteDataRow( csv_stream, CurMon, Separator, OutData, OutFound );
+							CurMon = MonthNames[ Month - 1 ];
+						}
+					}
+				}
+
+			} else if ( LineNo == 5 ) { // Run period
+				if ( NoDetails && NoMonDay && NoMon ) {
+					ErrorInLine = ! ReadStampFields( Line, 2, Fields );
+					if ( ! ErrorInLine ) {
+						if ( ! CurPer.empty() ) WriteDataRow( csv_stream, CurPer, Separator, OutData, OutFound );
+						CurPer = "simdays=" + std::to_string( static_cast< int >( Fields[ 1 ] ) );
+					}
+				}
+
+			} else if ( ! ErrorInLine && LineNo <= MaxRptNum ) { // Data line: value is the first field after the report number
+				int const Track( TrackIndex[ LineNo ] );
+				if ( Track >= 0 ) {
+					std::string::size_type const ValueEnd( Line.find( ',', Pos + 1 ) );
+					OutData[ Track ] = trimmed( Line.substr( Pos + 1, ValueEnd == std::string::npos ? std::string::npos : ValueEnd - Pos - 1 ) );
+					OutFound[ Track ] = true;
+				}
+			}
+
+			if ( ErrorInLine ) {
+				DisplayString( "Output file=" + OutputFileName + " error occured during processing." );
+				DisplayString( "Apparent line in error (1st 50 characters):" + Line.substr( 0, 50 ) );
+				audit_stream << " Output file=" << OutputFileName << '\n';
+				audit_stream << " error occured during processing.\n";
+				audit_stream << " Apparent line in error (1st 50 characters):\n";
+				audit_stream << ' ' << Line.substr( 0, 50 ) << '\n';
+				break;
+			}
+		}
+
+		if ( ! IgnoreFindVar.empty() ) {
+			audit_stream << " ignoring:\n";
+			for ( auto const & Name : IgnoreFindVar ) audit_stream << Name << '\n';
+		}
+		if ( ! FindVar.empty() ) {
+			audit_stream << " found/finding:\n";
+			for ( std::vector< std::string >::size_type Find = 0; Find < FindVar.size(); ++Find ) {
+				std::snprintf( LabelBuffer, sizeof( LabelBuffer ), "%6d ", std::abs( FindVarProcessed[ Find ] ) );
+				audit_stream << LabelBuffer << FindVar[ Find ] << ( FindVarProcessed[ Find ] < 0 ? "*" : "" ) << '\n';
+			}
+		}
+
+	}
+
+	std::string
+	VariableHeading( std::string const & DictionaryLine ) // Data dictionary line from the eso/mtr file
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         Linda Lawrie (ReadVarsESO)
+		//       DATE WRITTEN   1998
+		//       MODIFIED       na
+		//       RE-ENGINEERED  Oct 2026
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the csv column heading for a data dictionary line such as
+		// "6,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Hourly", that is,
+		// "Environment:Site Outdoor Air Drybulb Temperature [C](Hourly)".
+
+		// METHODOLOGY EMPLOYED:
+		// Drop the report number and item count, put the frequency (and any schedule name,
+		// but not the [Value,Min,...] list of averaged variables) in parentheses and turn the
+		// remaining commas into colons.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		std::string Heading;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string::size_type Pos;
+
+		Pos = DictionaryLine.find( ',' );
+		if ( Pos != std::string::npos ) Pos = DictionaryLine.find( ',', Pos + 1 );
+		std::string const Line( Pos == std::string::npos ? std::string() : DictionaryLine.substr( Pos + 1 ) );
+		Pos = Line.find( '!' );
+		if ( Pos == std::string::npos ) return Heading;
+
+		Heading = trimmed( Line.substr( 0, Pos ) ) + '(';
+		std::string const Frequency( Line.substr( Pos + 1 ) );
+		Pos = Frequency.find( '[' );
+		if ( Pos != std::string::npos ) { // Averaged variable, frequency is before the [
+			Heading += trimmed( Frequency.substr( 0, Pos ) );
+			std::string::size_type const EndPos( Frequency.find( ']', Pos ) );
+			if ( EndPos != std::string::npos && EndPos + 1 < Frequency.length() && Frequency[ EndPos + 1 ] == ',' ) {
+				Heading += trimmed( Frequency.substr( EndPos + 1 ) );
+			}
+		} else { // Summed variable
+			Heading += trimmed( Frequency );
+		}
+		Heading += ')';
+		std::replace( Heading.begin(), Heading.end(), ',', ':' );
+
+		return Heading;
+
+	}
+
+	void
+	WriteDataRow(
+		std::ostream & csv_stream, // Output (csv) stream
+		std::string const & TimeLabel, // Date/time label of this row
+		char const Separator, // Column separator
+		std::vector< std::string > const & OutData, // Current value of each column
+		std::vector< bool > & OutFound // True for each column with a value in this row (reset on exit)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda Lawrie (ReadVarsESO)
+		//       DATE WRITTEN   1998
+		//       MODIFIED       na
+		//       RE-ENGINEERED  Oct 2026
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes one row: the time label and the columns that have a value for this interval.
+		// Columns without a value are left empty; nothing is written when no column has a value.
+
+		// METHODOLOGY EMPLOYED:
+		// Separators for empty columns are held back until the next column with a value, so
+		// a row ends at its last value.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		bool AnyToPrint( false );
+		std::string::size_type NumEmpty( 0 ); // Separators held back for empty columns
+
+		for ( std::vector< std::string >::size_type Col = 0; Col < OutData.size(); ++Col ) {
+			if ( OutFound[ Col ] ) {
+				if ( ! AnyToPrint ) {
+					csv_stream << TimeLabel;
+					AnyToPrint = true;
+				}
+				if ( NumEmpty > 0 ) {
+					csv_stream << std::string( NumEmpty, Separator );
+					NumEmpty = 0;
+				}
+				csv_stream << Separator << OutData[ Col ];
+				OutFound[ Col ] = false;
+			} else {
+				++NumEmpty;
+			}
+		}
+		if ( AnyToPrint ) csv_stream << " \n";
+
+	}
+
+	bool
+	ReadStampFields(
+		std::string const & Line, // Time stamp line from the eso/mtr file
+		int const NumFields, // Number of leading fields to read
+		std::vector< Real64 > & Fields // Field values
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the leading comma separated numbers of a time stamp line; returns false
+		// if the line does not have that many numeric fields.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char const * Field( Line.c_str() );
+		char * FieldEnd;
+
+		Fields.resize( NumFields );
+		for ( int Loop = 0; Loop < NumFields; ++Loop ) {
+			Fields[ Loop ] = std::strtod( Field, &FieldEnd );
+			if ( FieldEnd == Field ) return false;
+			while ( *FieldEnd == ' ' ) ++FieldEnd;
+			if ( Loop + 1 < NumFields ) {
+				if ( *FieldEnd != ',' ) return false;
+				++FieldEnd;
+			}
+			Field = FieldEnd;
+		}
+		return true;
+
+	}
+
+	int
+	ProcessVarNumber( std::string const & String )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         Linda K. Lawrie (ReadVarsESO ProcessNumber)
+		//       DATE WRITTEN   September 1997
+		//       MODIFIED       na
+		//       RE-ENGINEERED  Oct 2026
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the report number on an rvi/mvi variable line, or -999 when the line
+		// is not a number (that is, a variable name).
+
+		// METHODOLOGY EMPLOYED:
+		// Like a list directed read, only the first blank delimited item is converted.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const ValidNumerics( "0123456789.+-" );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char * NumberEnd;
+
+		if ( String.empty() || ValidNumerics.find( String[ 0 ] ) == std::string::npos ) return -999;
+		std::string const Item( String.substr( 0, String.find_first_of( " /" ) ) );
+		Real64 const Value( std::strtod( Item.c_str(), &NumberEnd ) );
+		if ( NumberEnd == Item.c_str() || *NumberEnd != '\0' ) return -999;
+		return static_cast< int >( Value );
+
+	}
+
+	std::string::size_type
+	FindNoCase(
+		std::string const & String,
+		std::string const & SubString
+	)
+	{
+		// Case insensitive position of SubString in String (npos if not found)
+		return uppercased( String ).find( uppercased( SubString ) );
+	}
+
+} // ReadVars
+
+} // EnergyPlus
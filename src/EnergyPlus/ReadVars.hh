@@ -0,0 +1,68 @@
+#ifndef ReadVars_hh_INCLUDED
+#define ReadVars_hh_INCLUDED
+
+// C++ Headers
+#include <ostream>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace ReadVars {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	// na
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// MODULE VARIABLE DECLARATIONS:
+	// na
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE ReadVars
+
+	// Functions
+
+	void
+	ProcessVariableFile(
+		std::string const & VarFileName, // rvi/mvi file naming the input, output and variables to extract
+		std::string const & AuditFileName // Audit file to append processing notes to
+	);
+
+	std::string
+	VariableHeading( std::string const & DictionaryLine ); // Data dictionary line from the eso/mtr file
+
+	void
+	WriteDataRow(
+		std::ostream & csv_stream, // Output (csv) stream
+		std::string const & TimeLabel, // Date/time label of this row
+		char const Separator, // Column separator
+		std::vector< std::string > const & OutData, // Current value of each column
+		std::vector< bool > & OutFound // True for each column with a value in this row (reset on exit)
+	);
+
+	bool
+	ReadStampFields(
+		std::string const & Line, // Time stamp line from the eso/mtr file
+		int const NumFields, // Number of leading fields to read
+		std::vector< Real64 > & Fields // Field values
+	);
+
+	int
+	ProcessVarNumber( std::string const & String );
+
+	std::string::size_type
+	FindNoCase(
+		std::string const & String,
+		std::string const & SubString
+	);
+
+} // ReadVars
+
+} // EnergyPlus
+
+#endif
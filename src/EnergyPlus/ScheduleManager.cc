@@ -1,3 +1,7 @@
+// C++ Headers
+#include <fstream>
+#include <sstream>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
@@ -149,7 +153,6 @@ namespace ScheduleManager {
 		using DataStringGlobals::CharSpace;
 		using DataStringGlobals::CharSemicolon;
 		using DataGlobals::AnyEnergyManagementSystemInModel;
-		using DataSystemVariables::iUnicode_end;
 		using DataSystemVariables::TempFullFileName;
 		using DataSystemVariables::CheckForActualFileName;
 
@@ -248,28 +251,18 @@ namespace ScheduleManager {
 		bool FileExists;
 		// for SCHEDULE:FILE
 		Array1D< Real64 > hourlyFileValues;
-		int SchdFile;
-		int colCnt;
+		std::vector< ScheduleFileData > ScheduleFiles; // Files read so far
+		std::vector< ScheduleFileData >::size_type FileNum;
 		int rowCnt;
-		int wordStart;
-		int wordEnd;
-		std::string::size_type sepPos;
-		std::string LineIn;
-		std::string subString;
-		Real64 columnValue;
-		int read_stat;
 		int iDay;
 		int hDay;
 		int jHour;
 		int kDayType;
 		Real64 curHrVal;
-		bool errFlag;
 		std::string::size_type sPos;
 		std::string CurrentModuleObject; // for ease in getting objects
 		int MaxNums1;
-		std::string::size_type endLine;
-		std::string ColumnSep;
-		bool firstLine;
+		char ColumnSep;
 		bool FileIntervalInterpolated;
 		int rowLimitCount;
 		int skiprowCount;
@@ -1391,92 +1384,41 @@ namespace ScheduleManager {
 				ShowContinueError( "Try again with putting full path and file name in the field." );
 				ErrorsFound = true;
 			} else {
-				SchdFile = GetNewUnitNumber();
-				{ IOFlags flags; flags.ACTION( "read" ); gio::open( SchdFile, TempFullFileName, flags ); read_stat = flags.ios(); }
-				if ( read_stat != 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
-					ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
-					ShowFatalError( "Program terminates due to previous condition." );
+				// Each file is read and parsed once for all of the schedules that use it
+				FileNum = 0;
+				while ( FileNum < ScheduleFiles.size() ) {
+					auto const & file( ScheduleFiles[ FileNum ] );
+					if ( file.FileName == TempFullFileName && file.ColumnSep == ColumnSep && file.SkipRows == skiprowCount ) break;
+					++FileNum;
 				}
-				// check for stripping
-				{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-				endLine = len( LineIn );
-				if ( endLine > 0 ) {
-					if ( int( LineIn[ endLine - 1 ] ) == iUnicode_end ) {
-						gio::close( SchdFile );
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + " appears to be a Unicode or binary file." );
-						ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
+				if ( FileNum == ScheduleFiles.size() ) {
+					ScheduleFiles.push_back( ScheduleFileData() );
+					if ( ! ReadScheduleFile( TempFullFileName, ColumnSep, skiprowCount, ScheduleFiles.back() ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
+						ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
 						ShowFatalError( "Program terminates due to previous condition." );
 					}
 				}
-				gio::backspace( SchdFile );
-
-				// skip lines if any need to be skipped.
-				numerrors = 0;
-				rowCnt = 0;
-				read_stat = 0;
-				if ( skiprowCount > 0 ) { // Numbers(2) has number of rows to skip
-					while ( read_stat == 0 ) { //end of file
-						{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-						++rowCnt;
-						if ( rowCnt == skiprowCount ) {
-							break;
-						}
-					}
+				auto const & file( ScheduleFiles[ FileNum ] );
+				if ( file.Unicode ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + " appears to be a Unicode or binary file." );
+					ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
+					ShowFatalError( "Program terminates due to previous condition." );
+				}
+				if ( ! file.SeparatorFound && curcolCount > 1 ) {
+					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\" first line does not contain the indicated column separator=" + Alphas( 4 ) + '.' );
+					ShowContinueError( "...first 40 characters of line=[" + file.FirstRow.substr( 0, 40 ) + ']' );
 				}
 
-				//  proper number of lines are skipped.  read the file
-				// for the rest of the lines read from the file
-				rowCnt = 0;
-				firstLine = true;
-				while ( read_stat == 0 ) { //end of file
-					{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-					++rowCnt;
-					colCnt = 0;
-					wordStart = 0;
-					columnValue = 0.0;
-					//scan through the line looking for a specific column
-					while ( true ) {
-						sepPos = index( LineIn, ColumnSep );
-						++colCnt;
-						if ( sepPos != std::string::npos ) {
-							if ( sepPos > 0 ) {
-								wordEnd = sepPos - 1;
-							} else {
-								wordEnd = wordStart;
-							}
-							subString = LineIn.substr( wordStart, wordEnd - wordStart + 1 );
-							//the next word will start after the comma
-							wordStart = sepPos + 1;
-							//get rid of separator so next INDEX will find next separator
-							LineIn.erase( 0, wordStart );
-							firstLine = false;
-							wordStart = 0;
-						} else {
-							//no more commas
-							subString = LineIn.substr( wordStart );
-							if ( firstLine && subString == BlankString ) {
-								ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\" first line does not contain the indicated column separator=" + Alphas( 4 ) + '.' );
-								ShowContinueError( "...first 40 characters of line=[" + LineIn.substr( 0, 40 ) + ']' );
-								firstLine = false;
-							}
-							break;
-						}
-						if ( colCnt == curcolCount ) break;
-					}
-					if ( colCnt == curcolCount ) {
-						columnValue = ProcessNumber( subString, errFlag );
-						if ( errFlag ) {
-							++numerrors;
-							columnValue = 0.0;
-						}
-					} else {
-						columnValue = 0.0;
-					}
-					hourlyFileValues( rowCnt ) = columnValue;
-					if ( rowCnt == rowLimitCount ) break;
+				// pick this schedule's column out of the data rows
+				numerrors = 0;
+				rowCnt = min( int( file.RowStart.size() ) - 1, rowLimitCount );
+				for ( int Row = 0; Row < rowCnt; ++Row ) {
+					std::size_t const Field( file.RowStart[ Row ] + curcolCount - 1 );
+					if ( curcolCount < 1 || Field >= file.RowStart[ Row + 1 ] ) continue; // Row has no such column: value stays 0
+					if ( file.ValueErrors[ Field ] ) ++numerrors;
+					hourlyFileValues( Row + 1 ) = file.Values[ Field ];
 				}
-				gio::close( SchdFile );
 
 				// schedule values have been filled into the hourlyFileValues array.
 
@@ -1571,6 +1513,7 @@ namespace ScheduleManager {
 		}
 		if ( NumCommaFileSchedules > 0 ) {
 			hourlyFileValues.deallocate();
+			ScheduleFiles.clear();
 		}
 
 		MinuteValue.deallocate();
@@ -1844,6 +1787,162 @@ namespace ScheduleManager {
 
 	}
 
+	bool
+	ReadScheduleFile(
+		std::string const & FileName, // Full file name
+		char const ColumnSep, // Column separator
+		int const SkipRows, // Number of rows to skip at the top of the file
+		ScheduleFileData & FileData // File contents
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads a Schedule:File file and parses all of its columns.  Returns false if the
+		// file cannot be opened.
+
+		// METHODOLOGY EMPLOYED:
+		// The whole file is read into memory with a single read so that the schedules sharing
+		// it can take their columns from one parse instead of each rereading the file.
+
+		// REFERENCES:
+		// na
+
+		// Return value
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+
+		std::ifstream file_stream( FileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! file_stream ) return false;
+		std::stringstream file_text;
+		file_text << file_stream.rdbuf();
+
+		FileData.FileName = FileName;
+		ProcessScheduleFileText( file_text.str(), ColumnSep, SkipRows, FileData );
+		return true;
+
+	}
+
+	void
+	ProcessScheduleFileText(
+		std::string const & Text, // Text of the file
+		char const ColumnSep, // Column separator
+		int const SkipRows, // Number of rows to skip at the top of the file
+		ScheduleFileData & FileData // File contents
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Parses every field of every data row of a Schedule:File file.
+
+		// METHODOLOGY EMPLOYED:
+		// Each data row is split at the column separator and each field is processed as a
+		// number, as was done for one column at a time when each schedule read the file
+		// itself.  An empty field is processed as the separator character so that fields in
+		// error are counted the same way.  Field values are stored row by row with the start
+		// of each row, so a schedule can take its column from any row in constant time.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::ProcessNumber;
+		using DataSystemVariables::iUnicode_end;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string::size_type LineStart( 0 ); // Start of the current line in Text
+		std::string::size_type LineEnd; // End of the current line in Text
+		std::string LineIn; // Current line
+		std::string subString; // Current field
+		std::string::size_type wordStart; // Start of the current field in LineIn
+		std::string::size_type sepPos; // Position of the next separator in LineIn
+		int LineNum( 0 ); // Number of lines read
+		Real64 columnValue; // Value of the current field
+		bool errFlag; // True if the current field is not a valid number
+
+		FileData.ColumnSep = ColumnSep;
+		FileData.SkipRows = SkipRows;
+		FileData.Unicode = false;
+		FileData.SeparatorFound = false;
+		FileData.FirstRow.clear();
+		FileData.RowStart.clear();
+		FileData.Values.clear();
+		FileData.ValueErrors.clear();
+
+		while ( LineStart < Text.length() ) {
+			LineEnd = Text.find( '\n', LineStart );
+			if ( LineEnd == std::string::npos ) LineEnd = Text.length();
+			LineIn.assign( Text, LineStart, LineEnd - LineStart );
+			LineStart = LineEnd + 1;
+			if ( ! LineIn.empty() && LineIn[ LineIn.length() - 1 ] == '\r' ) LineIn.erase( LineIn.length() - 1 );
+			++LineNum;
+
+			// check for stripping
+			if ( LineNum == 1 && ! LineIn.empty() && int( LineIn[ LineIn.length() - 1 ] ) == iUnicode_end ) FileData.Unicode = true;
+			if ( LineNum <= SkipRows ) continue;
+
+			if ( FileData.RowStart.empty() ) FileData.FirstRow = LineIn;
+			FileData.RowStart.push_back( FileData.Values.size() );
+			wordStart = 0;
+			while ( true ) {
+				sepPos = LineIn.find( ColumnSep, wordStart );
+				if ( sepPos != std::string::npos ) {
+					FileData.SeparatorFound = true;
+					if ( sepPos > wordStart ) {
+						subString = LineIn.substr( wordStart, sepPos - wordStart );
+					} else {
+						subString = ColumnSep;
+					}
+				} else {
+					subString = LineIn.substr( wordStart );
+				}
+				columnValue = ProcessNumber( subString, errFlag );
+				if ( errFlag ) columnValue = 0.0;
+				FileData.Values.push_back( columnValue );
+				FileData.ValueErrors.push_back( errFlag );
+				if ( sepPos == std::string::npos ) break;
+				wordStart = sepPos + 1; // the next field starts after the separator
+			}
+		}
+		FileData.RowStart.push_back( FileData.Values.size() );
+
+	}
+
 	void
 	ReportScheduleDetails( int const LevelOfDetail ) // =1: hourly; =2: timestep; = 3: make IDF excerpt
 	{
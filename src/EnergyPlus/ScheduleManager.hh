@@ -1,6 +1,10 @@
 #ifndef ScheduleManager_hh_INCLUDED
 #define ScheduleManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1D.hh>
@@ -217,6 +221,29 @@ namespace ScheduleManager {
 
 	};
 
+	struct ScheduleFileData // Contents of a Schedule:File file, parsed once for all schedules using it
+	{
+		// Members
+		std::string FileName; // Full file name
+		char ColumnSep; // Column separator
+		int SkipRows; // Number of rows skipped at the top of the file
+		bool Unicode; // First line of the file ends as a Unicode or binary file does
+		bool SeparatorFound; // At least one data row contains the column separator
+		std::string FirstRow; // First data row
+		std::vector< std::size_t > RowStart; // Index in Values of the first field of each data row, then the number of fields
+		std::vector< Real64 > Values; // Field values of all data rows, row by row (0.0 for fields in error)
+		std::vector< bool > ValueErrors; // True for fields that are not valid numbers
+
+		// Default Constructor
+		ScheduleFileData() :
+			ColumnSep( ',' ),
+			SkipRows( 0 ),
+			Unicode( false ),
+			SeparatorFound( false )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< ScheduleTypeData > ScheduleType; // Allowed Schedule Types
 	extern Array1D< DayScheduleData > DaySchedule; // Day Schedule Storage
@@ -228,6 +255,22 @@ namespace ScheduleManager {
 	void
 	ProcessScheduleInput();
 
+	bool
+	ReadScheduleFile(
+		std::string const & FileName, // Full file name
+		char const ColumnSep, // Column separator
+		int const SkipRows, // Number of rows to skip at the top of the file
+		ScheduleFileData & FileData // File contents
+	);
+
+	void
+	ProcessScheduleFileText(
+		std::string const & Text, // Text of the file
+		char const ColumnSep, // Column separator
+		int const SkipRows, // Number of rows to skip at the top of the file
+		ScheduleFileData & FileData // File contents
+	);
+
 	void
 	ReportScheduleDetails( int const LevelOfDetail ); // =1: hourly; =2: timestep; = 3: make IDF excerpt
 
@@ -6813,7 +6813,8 @@ namespace SetPointManager {
 
 		// we don't need fluid names since we have a real index, so just pass in the temperature and get properties
 		Real64 avgTemp = ( returnNode.Temp + supplyNode.Temp ) / 2;
-		Real64 cp = FluidProperties::GetSpecificHeatGlycol( "", avgTemp, fluidIndex, "ReturnWaterChWSetPointManager::calculate" );
+		static std::string const RoutineName( "ReturnWaterChWSetPointManager::calculate" );
+		Real64 cp = FluidProperties::GetSpecificHeatGlycol( "", avgTemp, fluidIndex, RoutineName );
 
 		// get the operating flow rate
 		Real64 mdot = supplyNode.MassFlowRate;
@@ -6919,7 +6920,8 @@ namespace SetPointManager {
 
 		// we don't need fluid names since we have a real index, so just pass in the temperature and get properties
 		Real64 avgTemp = ( returnNode.Temp + supplyNode.Temp ) / 2;
-		Real64 cp = FluidProperties::GetSpecificHeatGlycol( "", avgTemp, fluidIndex, "ReturnWaterHWSetPointManager::calculate" );
+		static std::string const RoutineName( "ReturnWaterHWSetPointManager::calculate" );
+		Real64 cp = FluidProperties::GetSpecificHeatGlycol( "", avgTemp, fluidIndex, RoutineName );
 
 		// get the operating flow rate
 		Real64 mdot = supplyNode.MassFlowRate;
@@ -6,6 +6,9 @@ extern "C" {
 // C++ Headers
 #include <cmath>
 #include <string>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/environment.hh>
@@ -164,7 +167,7 @@ namespace SimulationManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   January 1997
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, mark the simulation phases for the performance log
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -302,8 +305,10 @@ namespace SimulationManager {
 
 		ManageBranchInput(); // just gets input and returns.
 
+		epStartPhase( PhaseSizing );
 		DoingSizing = true;
 		ManageSizing();
+		epStartPhase( PhaseGetInput );
 
 		CheckAndReadFaults();
 
@@ -394,7 +399,9 @@ namespace SimulationManager {
 
 		// if user requested HVAC Sizing Simulation, call HVAC sizing simulation manager
 		if ( DoHVACSizingSimulation ) {
+			epStartPhase( PhaseSizing );
 			ManageHVACSizingSimulation( ErrorsFound );
+			epStartPhase( PhaseGetInput );
 		}
 
 		ShowMessage( "Beginning Simulation" );
@@ -443,6 +450,7 @@ namespace SimulationManager {
 
 				if ( sqlite ) sqlite->sqliteBegin(); // setup for one transaction per day
 
+				epStartPhase( WarmupFlag ? PhaseWarmup : PhaseRunPeriod );
 				++DayOfSim;
 				gio::write( DayOfSimChr, fmtLD ) << DayOfSim;
 				strip( DayOfSimChr );
@@ -546,6 +554,7 @@ namespace SimulationManager {
 
 		if ( sqlite ) sqlite->sqliteBegin(); // for final data to write
 
+		epStartPhase( PhaseReporting );
 #ifdef EP_Detailed_Timings
 		epStartTime( "Closeout Reporting=" );
 #endif
@@ -594,7 +603,7 @@ namespace SimulationManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   November 1997
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, system timestep control fields of ConvergenceLimits
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -636,7 +645,7 @@ namespace SimulationManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Array1D_string Alphas( 6 );
-		Array1D< Real64 > Number( 4 );
+		Array1D< Real64 > Number( 5 );
 		int NumAlpha;
 		int NumNumber;
 		int IOStat;
@@ -821,11 +830,25 @@ namespace SimulationManager {
 			if ( MaxPlantSubIterations < 3 ) MaxPlantSubIterations = 3;
 			if ( MinPlantSubIterations > MaxPlantSubIterations ) MaxPlantSubIterations = MinPlantSubIterations + 1;
 
+			{ auto const SELECT_CASE_var( Alphas( 1 ) );
+			if ( ( SELECT_CASE_var == "ZONETEMPERATURECHANGE" ) || ( SELECT_CASE_var == "" ) ) {
+				SysTimeStepControl = SysTimeStepControlTempChange;
+			} else if ( SELECT_CASE_var == "TRUNCATIONERROR" ) {
+				SysTimeStepControl = SysTimeStepControlTruncationError;
+			} else {
+				ShowWarningError( CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 1 ) + " = " + Alphas( 1 ) + ". Set to ZoneTemperatureChange." );
+				SysTimeStepControl = SysTimeStepControlTempChange;
+			}}
+			MaxZoneTempError = 0.05;
+			if ( ! lNumericFieldBlanks( 5 ) && Number( 5 ) > 0.0 ) MaxZoneTempError = Number( 5 );
+
 		} else if ( Num == 0 ) {
 			MinTimeStepSys = 1.0 / 60.0;
 			MaxIter = 20;
 			MinPlantSubIterations = 2;
 			MaxPlantSubIterations = 8;
+			SysTimeStepControl = SysTimeStepControlTempChange;
+			MaxZoneTempError = 0.05;
 		} else {
 			ShowSevereError( "Too many " + CurrentModuleObject + " Objects found." );
 			ErrorsFound = true;
@@ -2577,6 +2600,7 @@ namespace SimulationManager {
 		int TotRectIZWindows;
 		int TotRectIZDoors;
 		int TotRectIZGlazedDoors;
+		int TotZones; // Number of Zone items
 		int iIDFsetThreadsInput;
 		int NumAlphas;
 		int NumNumbers;
@@ -2605,10 +2629,16 @@ namespace SimulationManager {
 		TotRectIntFloors = GetNumObjectsFound( "Floor:Adiabatic" );
 		TotRectIZFloors = GetNumObjectsFound( "Floor:Interzone" );
 
+		TotZones = GetNumObjectsFound( "Zone" );
+
 		iNominalTotSurfaces = TotHTSurfs + TotDetailedWalls + TotDetailedRoofs + TotDetailedFloors + TotHTSubs + TotIntMass + TotRectWindows + TotRectDoors + TotRectGlazedDoors + TotRectIZWindows + TotRectIZDoors + TotRectIZGlazedDoors + TotRectExtWalls + TotRectIntWalls + TotRectIZWalls + TotRectUGWalls + TotRectRoofs + TotRectCeilings + TotRectIZCeilings + TotRectGCFloors + TotRectIntFloors + TotRectIZFloors;
 
-#ifdef HBIRE_USE_OMP
+#if defined(HBIRE_USE_OMP) || defined(_OPENMP)
+#ifdef _OPENMP
+		MaxNumberOfThreads = omp_get_max_threads();
+#else
 		MaxNumberOfThreads = MAXTHREADS();
+#endif
 		Threading = true;
 
 		get_environment_variable( cNumThreads, cEnvValue );
@@ -2631,7 +2661,7 @@ namespace SimulationManager {
 		if ( GetNumObjectsFound( cCurrentModuleObject ) > 0 ) {
 			GetObjectItem( cCurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, ios, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 			iIDFSetThreads = int( rNumericArgs( 1 ) );
-			lIDFsetThreadsInput = true;
+			lIDFSetThreadsInput = true;
 			if ( iIDFSetThreads <= 0 ) {
 				iIDFSetThreads = MaxNumberOfThreads;
 				if ( lEnvSetThreadsInput ) iIDFSetThreads = iEnvSetThreads;
@@ -2654,6 +2684,18 @@ namespace SimulationManager {
 			if ( lepSetThreadsInput ) NumberIntRadThreads = iepEnvSetThreads;
 			if ( lIDFSetThreadsInput ) NumberIntRadThreads = iIDFSetThreads;
 		}
+
+		if ( TotZones <= 4 ) {
+			NumberZoneAirThreads = 1;
+			if ( lEnvSetThreadsInput ) NumberZoneAirThreads = iEnvSetThreads;
+			if ( lepSetThreadsInput ) NumberZoneAirThreads = iepEnvSetThreads;
+			if ( lIDFSetThreadsInput ) NumberZoneAirThreads = iIDFSetThreads;
+		} else {
+			NumberZoneAirThreads = MaxNumberOfThreads;
+			if ( lEnvSetThreadsInput ) NumberZoneAirThreads = iEnvSetThreads;
+			if ( lepSetThreadsInput ) NumberZoneAirThreads = iepEnvSetThreads;
+			if ( lIDFSetThreadsInput ) NumberZoneAirThreads = iIDFSetThreads;
+		}
 #else
 		Threading = false;
 		cCurrentModuleObject = "ProgramControl";
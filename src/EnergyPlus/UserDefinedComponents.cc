@@ -1337,7 +1337,7 @@ namespace UserDefinedComponents {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         <author>
 		//       DATE WRITTEN   <date_written>
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, register the interconnects between the plant connections
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1354,6 +1354,7 @@ namespace UserDefinedComponents {
 		using FluidProperties::GetDensityGlycol;
 		using FluidProperties::GetSpecificHeatGlycol;
 		using PlantUtilities::InitComponentNodes;
+		using PlantUtilities::InterConnectTwoPlantLoopSides;
 		using Psychrometrics::PsyRhoAirFnPbTdbW;
 		using Psychrometrics::PsyCpAirFnWTdb;
 
@@ -1374,6 +1375,7 @@ namespace UserDefinedComponents {
 		static Array1D_bool MyEnvrnFlag; // environment flag
 		static Array1D_bool MyFlag;
 		int ConnectionNum;
+		int OtherConnectionNum;
 		bool errFlag;
 		//  REAL(r64) :: rho
 		//  REAL(r64) :: Cp
@@ -1403,6 +1405,15 @@ namespace UserDefinedComponents {
 
 			}
 
+			// The loops connected through the component have to be known when the plant loops are grouped.
+			// Each connection is taken to demand on the connections listed after it.
+			for ( ConnectionNum = 1; ConnectionNum <= UserPlantComp( CompNum ).NumPlantConnections; ++ConnectionNum ) {
+				for ( OtherConnectionNum = ConnectionNum + 1; OtherConnectionNum <= UserPlantComp( CompNum ).NumPlantConnections; ++OtherConnectionNum ) {
+					if ( UserPlantComp( CompNum ).Loop( OtherConnectionNum ).LoopNum == UserPlantComp( CompNum ).Loop( ConnectionNum ).LoopNum ) continue;
+					InterConnectTwoPlantLoopSides( UserPlantComp( CompNum ).Loop( ConnectionNum ).LoopNum, UserPlantComp( CompNum ).Loop( ConnectionNum ).LoopSideNum, UserPlantComp( CompNum ).Loop( OtherConnectionNum ).LoopNum, UserPlantComp( CompNum ).Loop( OtherConnectionNum ).LoopSideNum, TypeOf_PlantComponentUserDefined, true );
+				}
+			}
+
 			MyFlag( CompNum ) = false;
 		}
 
@@ -52,7 +52,7 @@ AbortEnergyPlus()
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Linda K. Lawrie
 	//       DATE WRITTEN   December 1997
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, write the performance log
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -200,6 +200,7 @@ AbortEnergyPlus()
 #ifdef EP_Detailed_Timings
 	epSummaryTimes( Time_Finish - Time_Start );
 #endif
+	if ( PerformanceLogEnvFlag ) WritePerformanceLog( false );
 	CloseOutOpenFiles();
 	// Close the socket used by ExternalInterface. This call also sends the flag "-1" to the ExternalInterface,
 	// indicating that E+ terminated with an error.
@@ -329,7 +330,7 @@ EndEnergyPlus()
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Linda K. Lawrie
 	//       DATE WRITTEN   December 1997
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, write the performance log
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -430,6 +431,7 @@ EndEnergyPlus()
 #ifdef EP_Detailed_Timings
 	epSummaryTimes( Time_Finish - Time_Start );
 #endif
+	if ( PerformanceLogEnvFlag ) WritePerformanceLog( true );
 	CloseOutOpenFiles();
 	// Close the ExternalInterface socket. This call also sends the flag "1" to the ExternalInterface,
 	// indicating that E+ finished its simulation
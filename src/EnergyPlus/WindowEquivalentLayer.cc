@@ -4,6 +4,7 @@
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
 #include <WindowEquivalentLayer.hh>
@@ -107,6 +108,9 @@ namespace WindowEquivalentLayer {
 	int const hipTAU_BT0( 2 );
 	int const hipTAU_BB0( 3 );
 	int const hipDIM( 3 ); // dimension of parameter array
+	// beam off-normal property tables
+	Real64 const TblProfAngStep( 1.0 ); // profile angle step of the tables (deg)
+	Real64 const TblSlatAngStep( 2.0 ); // slat angle step of the tables (deg)
 
 	Array3D< Real64 > CFSDiffAbsTrans;
 	Array1D_bool EQLDiffPropFlag;
@@ -195,7 +199,7 @@ namespace WindowEquivalentLayer {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse
 		//       DATE WRITTEN   May 2013
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, tabulate beam off-normal properties of VB and PD layers
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -207,8 +211,9 @@ namespace WindowEquivalentLayer {
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using DataGlobals::OutputFileInits;
+		using General::RoundSigDigits;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -231,6 +236,12 @@ namespace WindowEquivalentLayer {
 		int NumGLayers; // number of gap layers
 		int NumSLayers; // number of glazing and shade layers (non-gas layers)
 		Array2D< Real64 > SysAbs1( 2, CFSMAXNL+1 ); // layers absorptance and system transmittance
+		Real64 MaxTblErr; // max interpolation error of a layer off-normal property table
+		Real64 MaxTblErrX1; // table angles of the max error (deg)
+		Real64 MaxTblErrX2;
+		static bool ReportTableHeader( true ); // eio header for the off-normal property tables
+		static gio::Fmt fmtA( "(A)" );
+		static gio::Fmt Format_700( "(' WindowEquivalentLayer Off-Normal Table',7(',',A))" );
 		// Flow
 
 		if ( ! allocated( CFSLayers ) ) CFSLayers.allocate( Construct( ConstrNum ).TotLayers );
@@ -385,6 +396,18 @@ namespace WindowEquivalentLayer {
 
 		if ( CFSHasControlledShade( CFS( EQLNum ) ) > 0 ) CFS( EQLNum ).ISControlled = true; // is controlled
 
+		// tabulate the beam off-normal properties of the VB and PD layers
+		for ( sLayer = 1; sLayer <= CFS( EQLNum ).NL; ++sLayer ) {
+			CFSLAYER & L( CFS( EQLNum ).L( sLayer ) );
+			SetupOffNormalPropertyTable( L, MaxTblErr, MaxTblErrX1, MaxTblErrX2 );
+			if ( ! allocated( L.SWP_TBL ) ) continue;
+			if ( ReportTableHeader ) {
+				gio::write( OutputFileInits, fmtA ) << "! <WindowEquivalentLayer Off-Normal Table>,Construction Name,Layer Name,#Profile Angles,#Slat or Horizontal Profile Angles,Max Interpolation Error,Profile Angle at Max Error {deg},Slat or Horizontal Profile Angle at Max Error {deg}";
+				ReportTableHeader = false;
+			}
+			gio::write( OutputFileInits, Format_700 ) << Construct( ConstrNum ).Name << L.Name << RoundSigDigits( L.SWP_TBL.isize1() ) << RoundSigDigits( L.SWP_TBL.isize2() ) << RoundSigDigits( MaxTblErr, 6 ) << RoundSigDigits( MaxTblErrX1, 1 ) << RoundSigDigits( MaxTblErrX2, 1 );
+		}
+
 	}
 
 	void
@@ -7127,14 +7150,15 @@ namespace WindowEquivalentLayer {
 		//       AUTHOR         JOHN L. WRIGHT, University of Waterloo, Mechanical Engineering
 		//                      Advanced Glazing System Laboratory
 		//       DATE WRITTEN   unknown
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, interpolate tabulated VB and PD properties
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Returns off-normal properties (total solar, beam-beam and beam diffuse) given
 		// direct-normal, total solar, beam-beam and beam diffuse properties of layers
 		// METHODOLOGY EMPLOYED:
-		//  na
+		//  VB and PD layers with a property table (see SetupOffNormalPropertyTable())
+		//  are interpolated, other layers are evaluated directly
 		// REFERENCES:
 		//  na
 		// USE STATEMENTS:
@@ -7171,11 +7195,23 @@ namespace WindowEquivalentLayer {
 			// HBX note: ltyGZS here iff modelOption F=x; spectral cases elsewhere
 			Specular_SWP( LSWP_ON, THETA );
 		} else if ( L.LTYPE == ltyVBHOR ) {
-			OKAY = VB_SWP( L, LSWP_ON, OMEGA_V );
+			if ( allocated( L.SWP_TBL ) ) {
+				InterpOffNormalProperties( L, RadiansToDeg * OMEGA_V, L.PHI_DEG, LSWP_ON );
+			} else {
+				OKAY = VB_SWP( L, LSWP_ON, OMEGA_V );
+			}
 		} else if ( L.LTYPE == ltyVBVER ) {
-			OKAY = VB_SWP( L, LSWP_ON, OMEGA_H );
+			if ( allocated( L.SWP_TBL ) ) {
+				InterpOffNormalProperties( L, RadiansToDeg * OMEGA_H, L.PHI_DEG, LSWP_ON );
+			} else {
+				OKAY = VB_SWP( L, LSWP_ON, OMEGA_H );
+			}
 		} else if ( L.LTYPE == ltyDRAPE ) {
-			OKAY = PD_SWP( L, LSWP_ON, OMEGA_V, OMEGA_H );
+			if ( allocated( L.SWP_TBL ) ) {
+				InterpOffNormalProperties( L, RadiansToDeg * std::abs( OMEGA_V ), RadiansToDeg * std::abs( OMEGA_H ), LSWP_ON );
+			} else {
+				OKAY = PD_SWP( L, LSWP_ON, OMEGA_V, OMEGA_H );
+			}
 		} else if ( L.LTYPE == ltyROLLB ) {
 			OKAY = RB_SWP( L, LSWP_ON, THETA );
 		} else if ( L.LTYPE == ltyINSCRN ) {
@@ -7187,6 +7223,174 @@ namespace WindowEquivalentLayer {
 		}
 	}
 
+	void
+	SetupOffNormalPropertyTable(
+		CFSLAYER & L, // layer for which to tabulate the beam off-normal properties
+		Real64 & MaxTblErr, // returned: max interpolation error at the table cell midpoints
+		Real64 & MaxTblErrX1, // returned: table angles of the max error (deg)
+		Real64 & MaxTblErrX2
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Tabulates the beam off-normal short wave properties of a venetian blind or drape
+		// layer so that ASHWAT_OffNormalProperties interpolates them rather than rerunning
+		// the slat and pleat models every time step.
+		// METHODOLOGY EMPLOYED:
+		// VB properties depend on the profile angle and the slat angle only. An uncontrolled
+		// blind keeps its slat angle, so its table has a single slat angle; a controlled blind
+		// is tabulated over -90 to 90 deg slat angles. PD properties depend on the magnitudes
+		// of the vertical and horizontal profile angles. The properties are also evaluated
+		// directly at the midpoint of every table cell and the largest difference from the
+		// interpolated value is returned with the angles where it occurs; the largest errors
+		// are found near grazing profile angles, where the models change steeply. Other layer types are cheap to evaluate and are not
+		// tabulated (L%SWP_TBL is left empty).
+		// REFERENCES:
+		//  na
+		// Using/Aliasing
+		using DataGlobals::DegToRadians;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int N1; // number of table points, VB: profile angle, PD: vertical profile angle
+		int N2; // number of table points, VB: slat angle, PD: horizontal profile angle
+		int I1;
+		int I2;
+		int IMID; // 0: table points, 1: cell midpoints
+		Real64 R1; // zero-based table positions
+		Real64 R2;
+		Real64 X1; // table angles (deg)
+		Real64 X2;
+		Real64 TblErr; // interpolation error at a cell midpoint
+		bool OKAY;
+		// Flow
+
+		MaxTblErr = 0.0;
+		MaxTblErrX1 = 0.0;
+		MaxTblErrX2 = 0.0;
+		if ( allocated( L.SWP_TBL ) ) L.SWP_TBL.deallocate();
+
+		if ( IsVBLayer( L ) ) {
+			N1 = nint( 180.0 / TblProfAngStep ) + 1;
+			N2 = 1;
+			if ( L.CNTRL != lscNONE ) N2 = nint( 180.0 / TblSlatAngStep ) + 1;
+		} else if ( L.LTYPE == ltyDRAPE ) {
+			N1 = nint( 90.0 / TblProfAngStep ) + 1;
+			N2 = N1;
+		} else {
+			return;
+		}
+
+		// Object Data
+		Array2D< CFSSWP > SWP_TBL( N1, N2 );
+		CFSLAYER LX( L ); // VB at table slat angle
+		CFSSWP SWPX; // directly evaluated properties
+		CFSSWP SWPI; // interpolated properties
+
+		for ( IMID = 0; IMID <= 1; ++IMID ) {
+			for ( I2 = 1; I2 <= max( N2 - IMID, 1 ); ++I2 ) {
+				for ( I1 = 1; I1 <= N1 - IMID; ++I1 ) {
+					R1 = I1 - 1 + 0.5 * IMID;
+					R2 = I2 - 1;
+					if ( N2 > 1 ) R2 += 0.5 * IMID;
+					SWPX = L.SWP_EL;
+					if ( IsVBLayer( L ) ) {
+						X1 = -90.0 + R1 * TblProfAngStep;
+						X2 = L.PHI_DEG;
+						if ( N2 > 1 ) X2 = -90.0 + R2 * TblSlatAngStep;
+						LX.PHI_DEG = X2;
+						OKAY = VB_SWP( LX, SWPX, DegToRadians * X1 );
+					} else {
+						X1 = R1 * TblProfAngStep;
+						X2 = R2 * TblProfAngStep;
+						OKAY = PD_SWP( L, SWPX, DegToRadians * X1, DegToRadians * X2 );
+					}
+					if ( IMID == 0 ) {
+						SWP_TBL( I1, I2 ) = SWPX;
+					} else {
+						SWPI = SWPX;
+						InterpOffNormalProperties( L, X1, X2, SWPI );
+						TblErr = max( std::abs( SWPI.RHOSFBD - SWPX.RHOSFBD ), std::abs( SWPI.RHOSBBD - SWPX.RHOSBBD ), std::abs( SWPI.TAUSFBB - SWPX.TAUSFBB ), std::abs( SWPI.TAUSBBB - SWPX.TAUSBBB ), std::abs( SWPI.TAUSFBD - SWPX.TAUSFBD ), std::abs( SWPI.TAUSBBD - SWPX.TAUSBBD ) );
+						if ( TblErr > MaxTblErr ) {
+							MaxTblErr = TblErr;
+							MaxTblErrX1 = X1;
+							MaxTblErrX2 = X2;
+						}
+					}
+				}
+			}
+			if ( IMID == 0 ) L.SWP_TBL = SWP_TBL;
+		}
+	}
+
+	void
+	InterpOffNormalProperties(
+		CFSLAYER const & L, // VB or PD layer with tabulated beam off-normal properties
+		Real64 const X1, // VB: profile angle, PD: vertical profile angle magnitude (deg)
+		Real64 const X2, // VB: slat angle, PD: horizontal profile angle magnitude (deg)
+		CFSSWP & LSWP // returned: beam off-normal properties
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the beam off-normal properties (RHOSFBD, RHOSBBD, TAUSFBB, TAUSBBB,
+		// TAUSFBD, TAUSBBD) of a VB or PD layer from its property table. Other
+		// members of LSWP are not changed.
+		// METHODOLOGY EMPLOYED:
+		// Bilinear interpolation in the table of SetupOffNormalPropertyTable(); angles
+		// outside the table are limited to its range. At table points the tabulated
+		// values are returned unchanged.
+		// REFERENCES:
+		//  na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const N1( L.SWP_TBL.isize1() );
+		int const N2( L.SWP_TBL.isize2() );
+		Real64 R1; // zero-based table positions
+		Real64 R2;
+		// Flow
+
+		if ( IsVBLayer( L ) ) {
+			R1 = ( X1 + 90.0 ) / TblProfAngStep;
+			R2 = ( X2 + 90.0 ) / TblSlatAngStep;
+		} else {
+			R1 = X1 / TblProfAngStep;
+			R2 = X2 / TblProfAngStep;
+		}
+		R1 = max( 0.0, min( Real64( N1 - 1 ), R1 ) );
+		R2 = max( 0.0, min( Real64( N2 - 1 ), R2 ) );
+
+		int const I1( min( int( R1 ), N1 - 2 ) + 1 );
+		int const I2( min( int( R2 ), max( N2 - 2, 0 ) ) + 1 );
+		int const I2P( min( I2 + 1, N2 ) );
+		Real64 const W1( R1 - ( I1 - 1 ) );
+		Real64 const W2( R2 - ( I2 - 1 ) );
+		Real64 const C11( ( 1.0 - W1 ) * ( 1.0 - W2 ) );
+		Real64 const C21( W1 * ( 1.0 - W2 ) );
+		Real64 const C12( ( 1.0 - W1 ) * W2 );
+		Real64 const C22( W1 * W2 );
+		CFSSWP const & P11( L.SWP_TBL( I1, I2 ) );
+		CFSSWP const & P21( L.SWP_TBL( I1 + 1, I2 ) );
+		CFSSWP const & P12( L.SWP_TBL( I1, I2P ) );
+		CFSSWP const & P22( L.SWP_TBL( I1 + 1, I2P ) );
+
+		LSWP.RHOSFBD = C11 * P11.RHOSFBD + C21 * P21.RHOSFBD + C12 * P12.RHOSFBD + C22 * P22.RHOSFBD;
+		LSWP.RHOSBBD = C11 * P11.RHOSBBD + C21 * P21.RHOSBBD + C12 * P12.RHOSBBD + C22 * P22.RHOSBBD;
+		LSWP.TAUSFBB = C11 * P11.TAUSFBB + C21 * P21.TAUSFBB + C12 * P12.TAUSFBB + C22 * P22.TAUSFBB;
+		LSWP.TAUSBBB = C11 * P11.TAUSBBB + C21 * P21.TAUSBBB + C12 * P12.TAUSBBB + C22 * P22.TAUSBBB;
+		LSWP.TAUSFBD = C11 * P11.TAUSFBD + C21 * P21.TAUSFBD + C12 * P12.TAUSFBD + C22 * P22.TAUSFBD;
+		LSWP.TAUSBBD = C11 * P11.TAUSBBD + C21 * P21.TAUSBBD + C12 * P12.TAUSBBD + C22 * P22.TAUSBBD;
+	}
+
 	bool
 	Specular_OffNormal(
 		Real64 const THETA, // solar beam angle of incidence, from normal radians
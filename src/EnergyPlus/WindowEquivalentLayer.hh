@@ -42,6 +42,9 @@ namespace WindowEquivalentLayer {
 	extern int const hipTAU_BT0;
 	extern int const hipTAU_BB0;
 	extern int const hipDIM; // dimension of parameter array
+	// beam off-normal property tables
+	extern Real64 const TblProfAngStep; // profile angle step of the tables (deg)
+	extern Real64 const TblSlatAngStep; // slat angle step of the tables (deg)
 
 	extern Array3D< Real64 > CFSDiffAbsTrans;
 	extern Array1D_bool EQLDiffPropFlag;
@@ -675,6 +678,22 @@ namespace WindowEquivalentLayer {
 		CFSSWP & LSWP_ON // returned: off-normal properties
 	);
 
+	void
+	SetupOffNormalPropertyTable(
+		CFSLAYER & L, // layer for which to tabulate the beam off-normal properties
+		Real64 & MaxTblErr, // returned: max interpolation error at the table cell midpoints
+		Real64 & MaxTblErrX1, // returned: table angles of the max error (deg)
+		Real64 & MaxTblErrX2
+	);
+
+	void
+	InterpOffNormalProperties(
+		CFSLAYER const & L, // VB or PD layer with tabulated beam off-normal properties
+		Real64 const X1, // VB: profile angle, PD: vertical profile angle magnitude (deg)
+		Real64 const X2, // VB: slat angle, PD: horizontal profile angle magnitude (deg)
+		CFSSWP & LSWP // returned: beam off-normal properties
+	);
+
 	bool
 	Specular_OffNormal(
 		Real64 const THETA, // solar beam angle of incidence, from normal radians
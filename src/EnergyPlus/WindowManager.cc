@@ -126,6 +126,9 @@ namespace WindowManager {
 	Array2D< Real64 > gwght( 5, 5, 0.0 ); // Gas molecular weights for each gap
 	Array2D< Real64 > gfract( 5, 5, 0.0 ); // Gas fractions for each gap
 	Array1D_int gnmix( 5, 0 ); // Number of gases in gap
+	Array3D< Real64 > gwghtroot4( 5, 5, 5, 0.0 ); // Fourth root of the ratio of molecular weights of gases i and j in each gap
+	Array3D< Real64 > gdowner( 5, 5, 5, 0.0 ); // Denominator of ISO 15099 eqs. 61, 64 and 66 for gases i and j in each gap
+	Array3D< Real64 > gpsiterm( 5, 5, 5, 0.0 ); // Molecular weight factor of ISO 15099 eq. 64 for gases i and j in each gap
 	Array1D< Real64 > gap( 5, 0.0 ); // Gap width (m)
 	Array1D< Real64 > thick( 5, 0.0 ); // Glass layer thickness (m)
 	Array1D< Real64 > scon( 5, 0.0 ); // Glass layer conductance--conductivity/thickness (W/m2-K)
@@ -2380,6 +2383,7 @@ namespace WindowManager {
 							gcp( ICoeff, IMix, IGap ) = Material( LayPtr ).GasCp( ICoeff, IMix );
 						}
 					}
+					WindowGasMixtureFactors( IGap );
 				}
 
 			} // End of loop over glass, gap and blind/shade layers in a window construction
@@ -4376,6 +4380,63 @@ namespace WindowManager {
 
 	//******************************************************************************
 
+	void
+	WindowGasMixtureFactors( int const IGap ) // Gap number
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the terms of the gas mixture equations in WindowGasConductance and
+		// WindowGasPropertiesAtTemp that only depend on the molecular weights of the gases in a gap.
+
+		// METHODOLOGY EMPLOYED:
+		// Called when the gas data of a gap is set, so that the terms are evaluated once per
+		// window instead of at every solution iteration. Same expressions as before, so the
+		// mixture properties are unchanged.
+
+		// REFERENCES:
+		// ISO 15099, eqs. 61, 64 and 66
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i;
+		int j;
+		int NMix; // Number of gases in a mixture
+
+		NMix = gnmix( IGap );
+		if ( NMix <= 1 ) return; // Single gas
+
+		for ( i = 1; i <= NMix; ++i ) {
+			for ( j = 1; j <= NMix; ++j ) {
+				gwghtroot4( i, j, IGap ) = root_4( gwght( i, IGap ) / gwght( j, IGap ) );
+				gdowner( i, j, IGap ) = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+				gpsiterm( i, j, IGap ) = 1.0 + 2.41 * ( gwght( i, IGap ) - gwght( j, IGap ) ) * ( gwght( i, IGap ) - 0.142 * gwght( j, IGap ) ) / pow_2( gwght( i, IGap ) + gwght( j, IGap ) );
+			}
+		}
+
+	}
+
+	//******************************************************************************
+
 	void
 	WindowGasConductance(
 		Real64 const tleft, // Temperature of gap surface closest to outside (K)
@@ -4414,7 +4475,6 @@ namespace WindowManager {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const pres( 1.0e5 ); // Gap gas pressure (Pa)
 		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
-		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -4504,23 +4564,25 @@ namespace WindowManager {
 				kdpdown( i ) = 1.0; // initialize denomonator of eq. 65
 			}
 
+			// Molecular weight terms are set in WindowGasMixtureFactors; only i != j terms are needed
 			for ( i = 1; i <= NMix; ++i ) {
 				for ( j = 1; j <= NMix; ++j ) {
+					if ( i == j ) continue;
 					// numerator of equation 61
-					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * root_4( gwght( j, IGap ) / gwght( i, IGap ) ) );
+					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * gwghtroot4( j, i, IGap ) );
 					// denomonator of eq. 61, 64 and 66
-					downer = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					downer = gdowner( i, j, IGap );
 					// calculate the denominator of eq. 60
-					if ( i != j ) mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
+					mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
 					// numerator of eq. 64; psiterm is the multiplied term in backets
-					psiup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * root_4( gwght( i, IGap ) / gwght( j, IGap ) ) );
-					psiterm = 1.0 + 2.41 * ( gwght( i, IGap ) - gwght( j, IGap ) ) * ( gwght( i, IGap ) - 0.142 * gwght( j, IGap ) ) / pow_2( gwght( i, IGap ) + gwght( j, IGap ) );
+					psiup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * gwghtroot4( i, j, IGap ) );
+					psiterm = gpsiterm( i, j, IGap );
 					// using the common denominator, downer, calculate the denominator for eq. 63
-					if ( i != j ) kpdown( i ) += psiup * ( psiterm / downer ) * ( frct( j ) / frct( i ) );
-					// calculate the numerator of eq. 66
-					phikup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * root_4( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					kpdown( i ) += psiup * ( psiterm / downer ) * ( frct( j ) / frct( i ) );
+					// the numerator of eq. 66 is the same as that of eq. 64
+					phikup = psiup;
 					// using the common denominator, downer, calculate the denomonator for eq. 65
-					if ( i != j ) kdpdown( i ) += ( phikup / downer ) * ( frct( j ) / frct( i ) );
+					kdpdown( i ) += ( phikup / downer ) * ( frct( j ) / frct( i ) );
 				}
 				mumix += fvis( i ) / mukpdwn( i ); // eq. 60
 				kpmix += kprime( i ) / kpdown( i ); // eq. 63
@@ -4583,7 +4645,6 @@ namespace WindowManager {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const pres( 1.0e5 ); // Gap gas pressure (Pa)
 		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
-		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -4634,14 +4695,16 @@ namespace WindowManager {
 				mukpdwn( i ) = 1.0; // initialize denomonator of eq. 60
 			}
 
+			// Molecular weight terms are set in WindowGasMixtureFactors; only i != j terms are needed
 			for ( i = 1; i <= NMix; ++i ) {
 				for ( j = 1; j <= NMix; ++j ) {
+					if ( i == j ) continue;
 					// numerator of equation 61
-					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * root_4( gwght( j, IGap ) / gwght( i, IGap ) ) );
+					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * gwghtroot4( j, i, IGap ) );
 					// denomonator of eq. 61, 64 and 66
-					downer = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					downer = gdowner( i, j, IGap );
 					// calculate the denominator of eq. 60
-					if ( i != j ) mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
+					mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
 				}
 				mumix += fvis( i ) / mukpdwn( i ); // eq. 60
 			}
@@ -6597,6 +6660,7 @@ namespace WindowManager {
 						gcp( ICoeff, IMix, IGap ) = Material( LayPtr ).GasCp( ICoeff, IMix );
 					}
 				}
+				WindowGasMixtureFactors( IGap );
 			}
 		}
 
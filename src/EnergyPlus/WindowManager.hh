@@ -3,7 +3,9 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2A.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array3D.hh>
 
 // EnergyPlus Headers
@@ -60,6 +62,9 @@ namespace WindowManager {
 	extern Array2D< Real64 > gwght; // Gas molecular weights for each gap
 	extern Array2D< Real64 > gfract; // Gas fractions for each gap
 	extern Array1D_int gnmix; // Number of gases in gap
+	extern Array3D< Real64 > gwghtroot4; // Fourth root of the ratio of molecular weights of gases i and j in each gap
+	extern Array3D< Real64 > gdowner; // Denominator of ISO 15099 eqs. 61, 64 and 66 for gases i and j in each gap
+	extern Array3D< Real64 > gpsiterm; // Molecular weight factor of ISO 15099 eq. 64 for gases i and j in each gap
 	extern Array1D< Real64 > gap; // Gap width (m)
 	extern Array1D< Real64 > thick; // Glass layer thickness (m)
 	extern Array1D< Real64 > scon; // Glass layer conductance--conductivity/thickness (W/m2-K)
@@ -295,6 +300,9 @@ namespace WindowManager {
 
 	//******************************************************************************
 
+	void
+	WindowGasMixtureFactors( int const IGap ); // Gap number
+
 	void
 	WindowGasConductance(
 		Real64 const tleft, // Temperature of gap surface closest to outside (K)
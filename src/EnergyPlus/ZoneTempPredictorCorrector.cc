@@ -10,6 +10,7 @@
 // EnergyPlus Headers
 #include <ZoneTempPredictorCorrector.hh>
 #include <DataAirflowNetwork.hh>
+#include <DataConvergParams.hh>
 #include <DataDefineEquip.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
@@ -21,6 +22,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -169,6 +171,13 @@ namespace ZoneTempPredictorCorrector {
 	Array1D< Real64 > ZoneTempOscillate;
 	Real64 AnyZoneTempOscillate;
 
+	// Largest estimated truncation error of the zone air temperatures in the last corrector step {C}
+	Real64 ZoneTempTruncationError( 0.0 );
+
+	// Heat balance sums of all zones calculated ahead of the zone loops, see CalcZoneSumsAllZones
+	bool ZoneSumsAirModelsChecked( false ); // True once the room air models of the zones have been checked
+	bool ZoneSumsAllZonesMixed( true ); // True when no zone uses a room air model
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Object Data
@@ -180,9 +189,31 @@ namespace ZoneTempPredictorCorrector {
 	Array1D< ZoneComfortFangerControlType > SetPointSingleCoolingFanger;
 	Array1D< ZoneComfortFangerControlType > SetPointSingleHeatCoolFanger;
 	Array1D< ZoneComfortFangerControlType > SetPointDualHeatCoolFanger;
+	Array1D< ZoneSumsData > ZoneSums; // Heat balance sums of each zone for the current predictor or corrector step
 
 	// Functions
 
+	void
+	clear_state()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Resets the state this module keeps between calls for the heat balance sums of all zones
+		// and the truncation error estimate, so a new simulation or unit test starts afresh.
+
+		ZoneSumsAirModelsChecked = false;
+		ZoneSumsAllZonesMixed = true;
+		ZoneSums.deallocate();
+		ZoneTempTruncationError = 0.0;
+
+	}
+
 	void
 	ManageZoneAirUpdates(
 		int const UpdateType, // Can be iGetZoneSetPoints, iPredictStep, iCorrectStep
@@ -1973,6 +2004,7 @@ namespace ZoneTempPredictorCorrector {
 			ZoneThermostatSetPointLo.dimension( NumOfZones, 0.0 );
 
 			LoadCorrectionFactor.dimension( NumOfZones, 0.0 ); //PH 3/3/04
+			ZoneSums.allocate( NumOfZones );
 			TempControlType.dimension( NumOfZones, 0 );
 			if ( NumComfortControlledZones > 0 ) {
 				ComfortControlType.dimension( NumOfZones, 0 );
@@ -2402,7 +2434,7 @@ namespace ZoneTempPredictorCorrector {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   May 1997
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, roll back the histories of all zones before the heat balance sums
 		//       RE-ENGINEERED  July 2003 (Peter Graham Ellis)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2481,14 +2513,6 @@ namespace ZoneTempPredictorCorrector {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 SumIntGain; // Zone sum of convective internal gains
-		Real64 SumHA; // Zone sum of Hc*Area
-		Real64 SumHATsurf; // Zone sum of Hc*Area*Tsurf
-		Real64 SumHATref; // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
-		Real64 SumMCp; // Zone sum of MassFlowRate*Cp
-		Real64 SumMCpT; // Zone sum of MassFlowRate*Cp*T
-		Real64 SumSysMCp; // Zone sum of air system MassFlowRate*Cp
-		Real64 SumSysMCpT; // Zone sum of air system MassFlowRate*Cp*T
 		Real64 TempDepCoef; // Formerly CoefSumha
 		Real64 TempIndCoef; // Formerly CoefSumhat
 		Real64 AirCap; // Formerly CoefAirrat
@@ -2568,10 +2592,10 @@ namespace ZoneTempPredictorCorrector {
 			}
 		}
 
-		// Update zone temperatures
-		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-
-			if ( ShortenTimeStepSys ) {
+		// Roll the zone air histories back to the shortened system timestep in all zones ahead of the heat
+		// balance sums, which read the zone air temperature, humidity ratio and node conditions
+		if ( ShortenTimeStepSys ) {
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 				// timestep has just shifted from full zone timestep to a new shorter system timestep
 				//throw away last updates in corrector and rewind for resimulating smaller timestep
 				if ( Zone( ZoneNum ).SystemZoneNodeNumber > 0 ) { // roll back result for zone air node,
@@ -2608,6 +2632,14 @@ namespace ZoneTempPredictorCorrector {
 				}
 
 			}
+		}
+
+		// Calculate the heat balance sums of all zones ahead of the zone loop when that can be multithreaded
+		bool const ZoneSumsPrecalculated( CalcZoneSumsAllZones( controlledZoneEquipConfigNums ) );
+
+		// Update zone temperatures
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+
 			// now update the variables actually used in the balance equations.
 			if ( UseZoneTimeStepHistory ) {
 				ZTM1( ZoneNum ) = XMAT( ZoneNum );
@@ -2635,10 +2667,11 @@ namespace ZoneTempPredictorCorrector {
 			// Calculate the various heat balance sums
 
 			// NOTE: SumSysMCp and SumSysMCpT are not used in the predict step
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			auto & zs( ZoneSums( ZoneNum ) );
+			if ( ! ZoneSumsPrecalculated ) CalcZoneSums( ZoneNum, zs.SumIntGain, zs.SumHA, zs.SumHATsurf, zs.SumHATref, zs.SumMCp, zs.SumMCpT, zs.SumSysMCp, zs.SumSysMCpT, controlledZoneEquipConfigNums );
 
-			TempDepCoef = SumHA + SumMCp;
-			TempIndCoef = SumIntGain + SumHATsurf - SumHATref + SumMCpT + SysDepZoneLoadsLagged( ZoneNum );
+			TempDepCoef = zs.SumHA + zs.SumMCp;
+			TempIndCoef = zs.SumIntGain + zs.SumHATsurf - zs.SumHATref + zs.SumMCpT + SysDepZoneLoadsLagged( ZoneNum );
 			if ( AirModel( ZoneNum ).AirModelType == RoomAirModel_Mixing ) {
 				TempHistoryTerm = AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) );
 				TempDepZnLd( ZoneNum ) = ( 11.0 / 6.0 ) * AirCap + TempDepCoef;
@@ -3552,6 +3585,8 @@ namespace ZoneTempPredictorCorrector {
 		//       AUTHOR         Russell Taylor
 		//       DATE WRITTEN   ???
 		//       MODIFIED       November 1999, LKL;
+		//                      Oct 2026, estimate the truncation error of the zone air temperatures
+		//                      Oct 2026, roll back the histories of all zones before the heat balance sums
 		//       RE-ENGINEERED  July 2003 (Peter Graham Ellis)
 		//                      February 2008 (Brent Griffith reworked history )
 
@@ -3560,7 +3595,9 @@ namespace ZoneTempPredictorCorrector {
 		// time step.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The truncation error of each zone air temperature is estimated by
+		// UpdateZoneTempTruncationError.  HVACManager uses the largest of these,
+		// ZoneTempTruncationError, with TruncationError system timestep control.
 
 		// REFERENCES:
 		// na
@@ -3611,14 +3648,6 @@ namespace ZoneTempPredictorCorrector {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 CpAir; // specific heat of air
-		static Real64 SumIntGain( 0.0 ); // Zone sum of convective internal gains
-		static Real64 SumHA( 0.0 ); // Zone sum of Hc*Area
-		static Real64 SumHATsurf( 0.0 ); // Zone sum of Hc*Area*Tsurf
-		static Real64 SumHATref( 0.0 ); // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
-		static Real64 SumMCp( 0.0 ); // Zone sum of MassFlowRate*Cp
-		static Real64 SumMCpT( 0.0 ); // Zone sum of MassFlowRate*Cp*T
-		static Real64 SumSysMCp( 0.0 ); // Zone sum of air system MassFlowRate*Cp
-		static Real64 SumSysMCpT( 0.0 ); // Zone sum of air system MassFlowRate*Cp*T
 		static Real64 ZoneEnthalpyIn( 0.0 ); // Zone inlet air enthalpy
 		static Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
 		static Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
@@ -3635,6 +3664,7 @@ namespace ZoneTempPredictorCorrector {
 		// FLOW:
 		// Initializations
 		ZoneTempChange = constant_zero;
+		ZoneTempTruncationError = 0.0;
 
 		//Tuned Precompute controlled equip zone numbers for performance
 		std::vector< int > controlledZoneEquipConfigNums;
@@ -3644,12 +3674,10 @@ namespace ZoneTempPredictorCorrector {
 			}
 		}
 
-		// Update zone temperatures
-		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-
-			ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-
-			if ( ShortenTimeStepSys ) {
+		// Roll the zone air histories back to the shortened system timestep in all zones ahead of the heat
+		// balance sums, which read the zone air temperature, humidity ratio and node conditions
+		if ( ShortenTimeStepSys ) {
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 				// time step has gotten smaller, use zone timestep history to interpolate new set of "DS" history terms.
 				if ( NumOfSysTimeSteps != NumOfSysTimeStepsLastZoneTimeStep ) { // cannot reuse existing DS data, interpolate from zone time
 					DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MAT( ZoneNum ), XMAT( ZoneNum ), XM2T( ZoneNum ), XM3T( ZoneNum ), XM4T( ZoneNum ), MAT( ZoneNum ), DSXMAT( ZoneNum ), DSXM2T( ZoneNum ), DSXM3T( ZoneNum ), DSXM4T( ZoneNum ) );
@@ -3665,6 +3693,15 @@ namespace ZoneTempPredictorCorrector {
 
 				}
 			}
+		}
+
+		// Calculate the heat balance sums of all zones ahead of the zone loop when that can be multithreaded
+		bool const ZoneSumsPrecalculated( CalcZoneSumsAllZones( controlledZoneEquipConfigNums ) );
+
+		// Update zone temperatures
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+
+			ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 
 			// now update the variables actually used in the balance equations.
 			if ( ! UseZoneTimeStepHistory ) {
@@ -3692,7 +3729,16 @@ namespace ZoneTempPredictorCorrector {
 			ManageAirModel( ZoneNum );
 
 			// Calculate the various heat balance sums
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			auto & zs( ZoneSums( ZoneNum ) );
+			if ( ! ZoneSumsPrecalculated ) CalcZoneSums( ZoneNum, zs.SumIntGain, zs.SumHA, zs.SumHATsurf, zs.SumHATref, zs.SumMCp, zs.SumMCpT, zs.SumSysMCp, zs.SumSysMCpT, controlledZoneEquipConfigNums );
+			Real64 const SumIntGain( zs.SumIntGain );
+			Real64 const SumHA( zs.SumHA );
+			Real64 const SumHATsurf( zs.SumHATsurf );
+			Real64 const SumHATref( zs.SumHATref );
+			Real64 const SumMCp( zs.SumMCp );
+			Real64 const SumMCpT( zs.SumMCpT );
+			Real64 const SumSysMCp( zs.SumSysMCp );
+			Real64 const SumSysMCpT( zs.SumSysMCpT );
 			//    ZoneTempHistoryTerm = (3.0D0 * ZTM1(ZoneNum) - (3.0D0/2.0D0) * ZTM2(ZoneNum) + (1.0D0/3.0D0) * ZTM3(ZoneNum))
 			ZoneNodeNum = Zone( ZoneNum ).SystemZoneNodeNumber;
 
@@ -3860,6 +3906,9 @@ namespace ZoneTempPredictorCorrector {
 				}
 			}}
 
+			// ZoneTempTruncationError is used by HVACManager with TruncationError system timestep control.
+			UpdateZoneTempTruncationError( ZoneNum );
+
 			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance, controlledZoneEquipConfigNums ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
 
 		} // ZoneNum
@@ -4464,6 +4513,85 @@ namespace ZoneTempPredictorCorrector {
 
 	}
 
+	bool
+	CalcZoneSumsAllZones( std::vector< int > const & controlledZoneEquipConfigNums ) // Precomputed controlled equip nums
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Calculates the heat balance sums of every zone into ZoneSums ahead of the predictor and
+		// corrector zone loops, spreading the zones over NumberZoneAirThreads threads.  Returns false,
+		// leaving the sums to be calculated zone by zone inside those loops, when running single
+		// threaded or when a room air model is in use.
+
+		// METHODOLOGY EMPLOYED:
+		// The sums of a zone depend only on its own surfaces, internal gains and inlet nodes and on its
+		// interzone mixing terms (MCPM, MCPTM, ...), which CalcAirFlowSimple has already gathered for
+		// each receiving zone before the predictor and corrector are called.  The predictor and corrector
+		// roll the zone air temperature, humidity ratio and node histories back for a shortened system
+		// timestep in all zones before calling this, and their zone loops do not change anything else the
+		// sums read, so each zone gets the same sums whichever thread calculates them.  Room air models
+		// update surface reference temperatures and nodes from inside the corrector zone loop, so those
+		// keep the zone by zone calculation.
+		// Nothing that can report an error or stop the run may be called from the threads.  The one fatal
+		// error in CalcZoneSums, a ceiling diffuser surface in a zone that no system serves, is looked for
+		// here before the zones are spread over the threads; the convection algorithms can change the
+		// surface reference air temperatures at any time step, so this is done on every call.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::NumberZoneAirThreads;
+		using DataRoomAirModel::AirModel;
+		using DataRoomAirModel::RoomAirModel_Mixing;
+		using DataSurfaces::Surface;
+		using DataSurfaces::ZoneSupplyAirTemp;
+		using DataZoneEquipment::ZoneEquipConfig;
+
+		if ( NumberZoneAirThreads <= 1 || NumOfZones <= 1 ) return false;
+
+		if ( ! ZoneSumsAirModelsChecked ) {
+			ZoneSumsAllZonesMixed = true;
+			for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				if ( AirModel( ZoneNum ).AirModelType != RoomAirModel_Mixing ) ZoneSumsAllZonesMixed = false;
+			}
+			ZoneSumsAirModelsChecked = true;
+		}
+		if ( ! ZoneSumsAllZonesMixed ) return false;
+
+		// Surfaces using the supply air temperature as reference in zones that no system serves
+		std::vector< bool > ControlledZoneAirFlag( NumOfZones + 1, false );
+		for ( auto const ZoneEquipConfigNum : controlledZoneEquipConfigNums ) {
+			int const ActualZoneNum( ZoneEquipConfig( ZoneEquipConfigNum ).ActualZoneNum );
+			if ( ActualZoneNum >= 1 && ActualZoneNum <= NumOfZones ) ControlledZoneAirFlag[ ActualZoneNum ] = true;
+		}
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ControlledZoneAirFlag[ ZoneNum ] ) continue;
+			for ( int SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+				if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+				if ( Surface( SurfNum ).TAirRef == ZoneSupplyAirTemp ) {
+					ShowFatalError( "Zones must be controlled for Ceiling-Diffuser Convection model. No system serves zone " + Zone( ZoneNum ).Name );
+				}
+			}
+		}
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberZoneAirThreads )
+#endif
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			auto & zs( ZoneSums( ZoneNum ) );
+			CalcZoneSums( ZoneNum, zs.SumIntGain, zs.SumHA, zs.SumHATsurf, zs.SumHATref, zs.SumMCp, zs.SumMCpT, zs.SumSysMCp, zs.SumSysMCpT, controlledZoneEquipConfigNums );
+		}
+
+		return true;
+	}
+
 	void
 	CalcZoneSums(
 		int const ZoneNum, // Zone number
@@ -5314,6 +5442,77 @@ namespace ZoneTempPredictorCorrector {
 		}
 	}
 
+	void
+	UpdateZoneTempTruncationError( int const ZoneNum ) // zone whose air temperature has just been corrected
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Raises ZoneTempTruncationError to the estimated truncation error of the zone air
+		// temperature ZT just calculated by CorrectZoneAirTemp, when that is larger.
+
+		// METHODOLOGY EMPLOYED:
+		// The estimate is the difference between ZT and the extrapolation of the temperature
+		// history ZTM1, ZTM2, ZTM3 through the current time (the predictor of a predictor-corrector
+		// pair): the third difference for the third order backward difference method, zero while
+		// the temperature follows a quadratic, and half the second difference for the first order
+		// methods, zero while the temperature drifts linearly.
+
+		// REFERENCES:
+		// na
+
+		if ( ZoneAirSolutionAlgo == Use3rdOrder ) {
+			ZoneTempTruncationError = max( ZoneTempTruncationError, std::abs( ZT( ZoneNum ) - ( 3.0 * ZTM1( ZoneNum ) - 3.0 * ZTM2( ZoneNum ) + ZTM3( ZoneNum ) ) ) );
+		} else {
+			ZoneTempTruncationError = max( ZoneTempTruncationError, 0.5 * std::abs( ZT( ZoneNum ) - ( 2.0 * ZTM1( ZoneNum ) - ZTM2( ZoneNum ) ) ) );
+		}
+
+	}
+
+	int
+	NumSysTimeStepsForTruncationError( Real64 const TruncationError ) // estimated truncation error of the zone air temperatures {C}
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the number of system timesteps in the zone timestep that brings the
+		// truncation error of the zone air temperatures, estimated over the zone timestep
+		// by CorrectZoneAirTemp, down to MaxZoneTempError, at most LimitNumSysSteps.
+
+		// METHODOLOGY EMPLOYED:
+		// The error estimate is a third difference of the temperature history for the
+		// third order backward difference method and a second difference for the first
+		// order methods, so it scales with the timestep cubed or squared.  Splitting the
+		// zone timestep into N system timesteps reduces it by N^3 or N^2.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataConvergParams::MaxZoneTempError;
+
+		// Return value
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 const Order( ( ZoneAirSolutionAlgo == Use3rdOrder ) ? 3.0 : 2.0 ); // power of the timestep in the error estimate
+
+		if ( TruncationError <= MaxZoneTempError ) return 1;
+		Real64 const NumSteps( std::pow( TruncationError / MaxZoneTempError, 1.0 / Order ) + 1.0 ); // add 1 for truncation
+		return int( min( NumSteps, double( max( LimitNumSysSteps, 1 ) ) ) );
+
+	}
+
 	void
 	AdjustAirSetPointsforOpTempCntrl(
 		int const TempControlledZoneID,
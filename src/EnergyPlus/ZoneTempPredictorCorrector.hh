@@ -96,6 +96,13 @@ namespace ZoneTempPredictorCorrector {
 	extern Array1D< Real64 > ZoneTempOscillate;
 	extern Real64 AnyZoneTempOscillate;
 
+	// Largest estimated truncation error of the zone air temperatures in the last corrector step {C}
+	extern Real64 ZoneTempTruncationError;
+
+	// Heat balance sums of all zones calculated ahead of the zone loops, see CalcZoneSumsAllZones
+	extern bool ZoneSumsAirModelsChecked; // True once the room air models of the zones have been checked
+	extern bool ZoneSumsAllZonesMixed; // True when no zone uses a room air model
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Types
@@ -178,6 +185,32 @@ namespace ZoneTempPredictorCorrector {
 
 	};
 
+	struct ZoneSumsData
+	{
+		// Members
+		Real64 SumIntGain; // Zone sum of convective internal gains
+		Real64 SumHA; // Zone sum of Hc*Area
+		Real64 SumHATsurf; // Zone sum of Hc*Area*Tsurf
+		Real64 SumHATref; // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
+		Real64 SumMCp; // Zone sum of MassFlowRate*Cp
+		Real64 SumMCpT; // Zone sum of MassFlowRate*Cp*T
+		Real64 SumSysMCp; // Zone sum of air system MassFlowRate*Cp
+		Real64 SumSysMCpT; // Zone sum of air system MassFlowRate*Cp*T
+
+		// Default Constructor
+		ZoneSumsData() :
+			SumIntGain( 0.0 ),
+			SumHA( 0.0 ),
+			SumHATsurf( 0.0 ),
+			SumHATref( 0.0 ),
+			SumMCp( 0.0 ),
+			SumMCpT( 0.0 ),
+			SumSysMCp( 0.0 ),
+			SumSysMCpT( 0.0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< ZoneTempControlType > SetPointSingleHeating;
 	extern Array1D< ZoneTempControlType > SetPointSingleCooling;
@@ -187,9 +220,13 @@ namespace ZoneTempPredictorCorrector {
 	extern Array1D< ZoneComfortFangerControlType > SetPointSingleCoolingFanger;
 	extern Array1D< ZoneComfortFangerControlType > SetPointSingleHeatCoolFanger;
 	extern Array1D< ZoneComfortFangerControlType > SetPointDualHeatCoolFanger;
+	extern Array1D< ZoneSumsData > ZoneSums; // Heat balance sums of each zone for the current predictor or corrector step
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	ManageZoneAirUpdates(
 		int const UpdateType, // Can be iGetZoneSetPoints, iPredictStep, iCorrectStep
@@ -260,6 +297,9 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & newVal4 // unused 1208
 	);
 
+	bool
+	CalcZoneSumsAllZones( std::vector< int > const & controlledZoneEquipConfigNums ); // Precomputed controlled equip nums
+
 	void
 	CalcZoneSums(
 		int const ZoneNum, // Zone number
@@ -299,6 +339,12 @@ namespace ZoneTempPredictorCorrector {
 	void
 	DetectOscillatingZoneTemp();
 
+	void
+	UpdateZoneTempTruncationError( int const ZoneNum ); // zone whose air temperature has just been corrected
+
+	int
+	NumSysTimeStepsForTruncationError( Real64 const TruncationError ); // estimated truncation error of the zone air temperatures {C}
+
 	void
 	AdjustAirSetPointsforOpTempCntrl(
 		int const TempControlledZoneID,
@@ -0,0 +1,513 @@
+///////////////////////////////////////////////////////
+/// \file   utilShm.c
+///
+/// \brief  Methods for interfacing clients
+///         using a memory-mapped ring buffer.
+///
+/// See \c utilShm.h for the layout of the memory-mapped file.
+///
+///////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "defines.h"
+#include "utilShm.h"
+#include "utilXml.h"
+
+#ifdef _WIN32 /************* Windows: not available ********/
+
+int getshmfilename(const char *const docname, char *const fileName){
+  return -1;
+}
+
+int establishservershm(const char *const fileName, const int nDblMax){
+  fprintf(stderr, "Error: Shared memory communication is not available on Windows.\n");
+  return -1;
+}
+
+int establishclientshm(const char *const docname){
+  fprintf(stderr, "Error: Shared memory communication is not available on Windows.\n");
+  return -1;
+}
+
+int exchangedoubleswithshm(const int *shmfd,
+			   const int *flaWri, int *flaRea,
+			   const int *nDblWri,
+			   int *nDblRea,
+			   double *simTimWri,
+			   double dblValWri[],
+			   double *simTimRea,
+			   double dblValRea[]){
+  return -1;
+}
+
+int sendclientmessageshm(const int *shmfd, const int *flaWri){
+  return -1;
+}
+
+int readfromclientshm(const int *shmfd, int *flaRea, int *nDblRea,
+		      double *simTimRea, double dblValRea[]){
+  return -1;
+}
+
+int writetoclientshm(const int *shmfd, const int *flaWri, const int *nDblWri,
+		     double *simTimWri, double dblValWri[]){
+  return -1;
+}
+
+int loopbackshm(const int *shmfd){
+  return -1;
+}
+
+int closeshm(int *shmfd){
+  *shmfd = -1;
+  return 0;
+}
+
+#else /************* POSIX ********/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#define SHM_MAXHANDLES 8 // maximum number of open shared memory descriptors
+#define SHM_SPIN 1000 // number of polls before a waiting process yields
+#define SHM_YIELD 100 // number of yields before a waiting process sleeps
+#define SHM_ACKTIMEOUT 5000 // time to wait for an acknowledgement, ms
+#define SHM_CLIENT 0 // side and ring index of the client
+#define SHM_SERVER 1 // side and ring index of the server
+
+/// Ring control block, one cache line.
+typedef struct shmRing {
+  uint32_t head; ///< number of slots written
+  uint32_t tail; ///< number of slots read
+  uint32_t waiters; ///< number of processes waiting on head or tail
+  uint32_t pad[13];
+} shmRing;
+
+/// Header of the memory-mapped file.
+typedef struct shmHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t nSlo; ///< number of slots per ring
+  uint32_t nDblMax; ///< maximum number of doubles per slot
+  uint32_t sloSiz; ///< slot size in bytes
+  uint32_t attached[2]; ///< 1 while the client, server is attached
+  uint32_t pad[9];
+  shmRing ring[2]; ///< 0: client to server, 1: server to client
+} shmHeader;
+
+/// Message slot.
+typedef struct shmSlot {
+  int32_t fla;
+  int32_t nDbl;
+  double simTim;
+  double dblVal[1]; ///< nDblMax values
+} shmSlot;
+
+/// Open shared memory descriptor.
+typedef struct shmHandle {
+  int fd; ///< file descriptor, -1 if unused
+  int side; ///< SHM_CLIENT or SHM_SERVER
+  size_t size; ///< size of the mapping
+  char *base; ///< start of the mapping
+  char fileName[BUFFER_LENGTH]; ///< name of the file, used by the server to remove it
+} shmHandle;
+
+static shmHandle shmHandles[SHM_MAXHANDLES];
+static int shmHandlesInit = 0;
+
+static uint32_t shmload(uint32_t *p){
+  return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+}
+
+static void shmstore(uint32_t *p, uint32_t v){
+  __atomic_store_n(p, v, __ATOMIC_SEQ_CST);
+}
+
+static void shmwake(uint32_t *p){
+#ifdef __linux__
+  syscall(SYS_futex, p, FUTEX_WAKE, INT32_MAX, NULL, NULL, 0);
+#endif
+}
+
+static double shmmilliseconds(){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return 1000.0 * ts.tv_sec + 1.0e-6 * ts.tv_nsec;
+}
+
+static shmHandle *shmgethandle(const int *shmfd){
+  if ( *shmfd < 0 || *shmfd >= SHM_MAXHANDLES || shmHandles[*shmfd].fd < 0 ){
+    fprintf(stderr, "Error: Invalid shared memory descriptor %d.\n", *shmfd);
+    return NULL;
+  }
+  return &shmHandles[*shmfd];
+}
+
+static int shmnewhandle(){
+  int i;
+  if ( ! shmHandlesInit ){
+    for(i=0; i < SHM_MAXHANDLES; i++)
+      shmHandles[i].fd = -1;
+    shmHandlesInit = 1;
+  }
+  for(i=0; i < SHM_MAXHANDLES; i++){
+    if ( shmHandles[i].fd < 0 )
+      return i;
+  }
+  fprintf(stderr, "Error: Too many shared memory descriptors.\n");
+  return -1;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Waits until \c *word differs from \c old.
+///
+///\param h Shared memory handle.
+///\param r Ring that contains \c word.
+///\param word Head or tail word of the ring.
+///\param old Value to wait on.
+///\param timeout Maximum wait in ms, or a negative value to wait without limit.
+///\return 0 if \c *word changed, -3 if the other side detached, -4 on timeout.
+static int shmwait(shmHandle *h, int r, uint32_t *word, uint32_t old, double timeout){
+  shmHeader *hdr = (shmHeader *)h->base;
+  uint32_t *waiters = &hdr->ring[r].waiters;
+  uint32_t *peer = &hdr->attached[1 - h->side];
+  double start;
+  int i;
+#ifdef __linux__
+  struct timespec ts = {0, 100000000}; // 100 ms, to check the other side
+#else
+  struct timespec ts = {0, 20000}; // 20 us
+#endif
+  for(i=0; i < SHM_SPIN; i++){
+    if ( shmload(word) != old )
+      return 0;
+  }
+  // on a single processor the other side only runs if this process yields
+  for(i=0; i < SHM_YIELD; i++){
+    sched_yield();
+    if ( shmload(word) != old )
+      return 0;
+  }
+  start = shmmilliseconds();
+  for(;;){
+    __atomic_fetch_add(waiters, 1, __ATOMIC_SEQ_CST);
+    if ( shmload(word) == old ){
+#ifdef __linux__
+      syscall(SYS_futex, word, FUTEX_WAIT, old, &ts, NULL, 0);
+#else
+      nanosleep(&ts, NULL);
+#endif
+    }
+    __atomic_fetch_sub(waiters, 1, __ATOMIC_SEQ_CST);
+    if ( shmload(word) != old )
+      return 0;
+    // the server may wait before the client attached
+    if ( shmload(peer) == 0 && ( h->side == SHM_CLIENT || shmload(&hdr->ring[SHM_CLIENT].head) > 0 ) ){
+      fprintf(stderr, "Error: Shared memory peer detached.\n");
+      return -3;
+    }
+    if ( timeout >= 0 && shmmilliseconds() - start > timeout )
+      return -4;
+  }
+}
+
+static shmSlot *shmslot(shmHandle *h, int r, uint32_t seq){
+  shmHeader *hdr = (shmHeader *)h->base;
+  return (shmSlot *)(h->base + sizeof(shmHeader)
+		     + ((size_t)r * hdr->nSlo + seq % hdr->nSlo) * hdr->sloSiz);
+}
+
+/////////////////////////////////////////////////////////////////
+/// Writes a message to ring \c r.
+///\return 0 if no error occurred, or a negative value if an error occured.
+static int shmputmsg(shmHandle *h, int r, int fla, int nDbl, double simTim,
+		  const double dblVal[], double timeout){
+  shmHeader *hdr = (shmHeader *)h->base;
+  shmRing *ring = &hdr->ring[r];
+  uint32_t head = ring->head; // only written by this process
+  uint32_t tail;
+  shmSlot *slo;
+  int retVal;
+  if ( nDbl < 0 || (uint32_t)nDbl > hdr->nDblMax ){
+    fprintf(stderr, "Error: Cannot write %d doubles to shared memory, maximum is %u.\n",
+	    nDbl, hdr->nDblMax);
+    return -2;
+  }
+  while ( head - ( tail = shmload(&ring->tail) ) >= hdr->nSlo ){
+    retVal = shmwait(h, r, &ring->tail, tail, timeout);
+    if ( retVal )
+      return retVal;
+  }
+  slo = shmslot(h, r, head);
+  slo->fla = fla;
+  slo->nDbl = nDbl;
+  slo->simTim = simTim;
+  if ( nDbl > 0 )
+    memcpy(slo->dblVal, dblVal, nDbl * sizeof(double));
+  shmstore(&ring->head, head + 1);
+  if ( shmload(&ring->waiters) )
+    shmwake(&ring->head);
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Reads a message from ring \c r.
+///\return 0 if no error occurred, or a negative value if an error occured.
+static int shmgetmsg(shmHandle *h, int r, int *fla, int *nDbl, double *simTim,
+		  double dblVal[], double timeout){
+  shmHeader *hdr = (shmHeader *)h->base;
+  shmRing *ring = &hdr->ring[r];
+  uint32_t tail = ring->tail; // only written by this process
+  shmSlot *slo;
+  int retVal;
+  while ( shmload(&ring->head) == tail ){
+    retVal = shmwait(h, r, &ring->head, tail, timeout);
+    if ( retVal )
+      return retVal;
+  }
+  slo = shmslot(h, r, tail);
+  *fla = slo->fla;
+  *nDbl = slo->nDbl;
+  *simTim = slo->simTim;
+  if ( *nDbl < 0 || (uint32_t)*nDbl > hdr->nDblMax ){
+    fprintf(stderr, "Error: Read invalid number of doubles %d from shared memory.\n", *nDbl);
+    return -2;
+  }
+  if ( *nDbl > 0 && dblVal != NULL )
+    memcpy(dblVal, slo->dblVal, *nDbl * sizeof(double));
+  shmstore(&ring->tail, tail + 1);
+  if ( shmload(&ring->waiters) )
+    shmwake(&ring->tail);
+  return 0;
+}
+
+int getshmfilename(const char *const docname, char *const fileName) {
+  char *xPat = "//ipc/sharedmemory[@file]";
+  int i;
+  int r = getxmlvalue(docname, xPat, fileName, &i, BUFFER_LENGTH);
+  return r;
+}
+
+int establishservershm(const char *const fileName, const int nDblMax){
+  int i, fd;
+  size_t sloSiz, size;
+  char *base;
+  shmHeader *hdr;
+  if ( nDblMax < 1 || strlen(fileName) >= BUFFER_LENGTH ){
+    fprintf(stderr, "Error: Invalid arguments for shared memory file '%s'.\n", fileName);
+    return -1;
+  }
+  i = shmnewhandle();
+  if ( i < 0 )
+    return -1;
+  // slot size rounded up to a cache line
+  sloSiz = ( ( sizeof(shmSlot) + ( nDblMax - 1 ) * sizeof(double) + 63 ) / 64 ) * 64;
+  size = sizeof(shmHeader) + 2 * SHM_NSLOTS * sloSiz;
+
+  fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if ( fd < 0 ){
+    fprintf(stderr, "Error: Could not create shared memory file '%s': %s.\n",
+	    fileName, strerror(errno));
+    return -1;
+  }
+  if ( ftruncate(fd, size) != 0 ){
+    fprintf(stderr, "Error: Could not size shared memory file '%s': %s.\n",
+	    fileName, strerror(errno));
+    close(fd);
+    return -1;
+  }
+  base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if ( base == MAP_FAILED ){
+    fprintf(stderr, "Error: Could not map shared memory file '%s': %s.\n",
+	    fileName, strerror(errno));
+    close(fd);
+    return -1;
+  }
+  memset(base, 0, sizeof(shmHeader));
+  hdr = (shmHeader *)base;
+  hdr->version = SHM_VERSION;
+  hdr->nSlo = SHM_NSLOTS;
+  hdr->nDblMax = nDblMax;
+  hdr->sloSiz = sloSiz;
+  shmstore(&hdr->attached[SHM_SERVER], 1);
+  // the magic number is written last, a client only attaches to a complete header
+  shmstore(&hdr->magic, SHM_MAGIC);
+
+  shmHandles[i].fd = fd;
+  shmHandles[i].side = SHM_SERVER;
+  shmHandles[i].size = size;
+  shmHandles[i].base = base;
+  strcpy(shmHandles[i].fileName, fileName);
+  return i;
+}
+
+int establishclientshm(const char *const docname){
+  int i, fd;
+  struct stat st;
+  char *fileName;
+  char *base;
+  shmHeader *hdr;
+  fileName = malloc(BUFFER_LENGTH);
+  if ( fileName == NULL ){
+    perror("malloc failed in establishclientshm.");
+    return -2;
+  }
+  if ( getshmfilename(docname, fileName) != 0 ){
+    fprintf(stderr, "Error: Could not obtain shared memory file name from '%s'.\n", docname);
+    free(fileName);
+    return -1;
+  }
+  i = shmnewhandle();
+  if ( i < 0 ){
+    free(fileName);
+    return -1;
+  }
+  fd = open(fileName, O_RDWR);
+  if ( fd < 0 || fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(shmHeader) ){
+    fprintf(stderr, "Error: Could not open shared memory file '%s'.\n", fileName);
+    if ( fd >= 0 )
+      close(fd);
+    free(fileName);
+    return -1;
+  }
+  base = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if ( base == MAP_FAILED ){
+    fprintf(stderr, "Error: Could not map shared memory file '%s': %s.\n",
+	    fileName, strerror(errno));
+    close(fd);
+    free(fileName);
+    return -1;
+  }
+  hdr = (shmHeader *)base;
+  if ( shmload(&hdr->magic) != SHM_MAGIC || hdr->version != SHM_VERSION
+       || (size_t)st.st_size < sizeof(shmHeader) + 2 * (size_t)hdr->nSlo * hdr->sloSiz ){
+    fprintf(stderr, "Error: File '%s' is not a shared memory file of version %d.\n",
+	    fileName, SHM_VERSION);
+    munmap(base, st.st_size);
+    close(fd);
+    free(fileName);
+    return -1;
+  }
+  shmstore(&hdr->attached[SHM_CLIENT], 1);
+
+  shmHandles[i].fd = fd;
+  shmHandles[i].side = SHM_CLIENT;
+  shmHandles[i].size = st.st_size;
+  shmHandles[i].base = base;
+  strcpy(shmHandles[i].fileName, fileName);
+  free(fileName);
+  return i;
+}
+
+int exchangedoubleswithshm(const int *shmfd,
+			   const int *flaWri, int *flaRea,
+			   const int *nDblWri,
+			   int *nDblRea,
+			   double *simTimWri,
+			   double dblValWri[],
+			   double *simTimRea,
+			   double dblValRea[]){
+  int retVal;
+  shmHandle *h = shmgethandle(shmfd);
+  if ( h == NULL )
+    return -1;
+  retVal = shmputmsg(h, SHM_CLIENT, *flaWri, *nDblWri, *simTimWri, dblValWri, -1.0);
+  if ( retVal )
+    return retVal;
+  return shmgetmsg(h, SHM_SERVER, flaRea, nDblRea, simTimRea, dblValRea, -1.0);
+}
+
+int sendclientmessageshm(const int *shmfd, const int *flaWri){
+  int retVal, fla, nDbl;
+  double simTim;
+  shmHandle *h = shmgethandle(shmfd);
+  if ( h == NULL )
+    return -1;
+  retVal = shmputmsg(h, SHM_CLIENT, *flaWri, 0, 0.0, NULL, SHM_ACKTIMEOUT);
+  if ( retVal )
+    return retVal;
+  // wait for the acknowledgement, as for the socket
+  return shmgetmsg(h, SHM_SERVER, &fla, &nDbl, &simTim, NULL, SHM_ACKTIMEOUT);
+}
+
+int readfromclientshm(const int *shmfd, int *flaRea, int *nDblRea,
+		      double *simTimRea, double dblValRea[]){
+  shmHandle *h = shmgethandle(shmfd);
+  if ( h == NULL )
+    return -1;
+  return shmgetmsg(h, SHM_CLIENT, flaRea, nDblRea, simTimRea, dblValRea, -1.0);
+}
+
+int writetoclientshm(const int *shmfd, const int *flaWri, const int *nDblWri,
+		     double *simTimWri, double dblValWri[]){
+  shmHandle *h = shmgethandle(shmfd);
+  if ( h == NULL )
+    return -1;
+  return shmputmsg(h, SHM_SERVER, *flaWri, *nDblWri, *simTimWri, dblValWri, -1.0);
+}
+
+int loopbackshm(const int *shmfd){
+  int retVal, fla, nDbl, nMsg = 0;
+  double simTim;
+  double *dblVal;
+  shmHandle *h = shmgethandle(shmfd);
+  if ( h == NULL )
+    return -1;
+  dblVal = malloc(((shmHeader *)h->base)->nDblMax * sizeof(double));
+  if ( dblVal == NULL ){
+    perror("malloc failed in loopbackshm.");
+    return -2;
+  }
+  for(;;){
+    retVal = readfromclientshm(shmfd, &fla, &nDbl, &simTim, dblVal);
+    if ( retVal )
+      break;
+    if ( fla != 0 ){
+      // acknowledge the flag and stop
+      nDbl = 0;
+      retVal = writetoclientshm(shmfd, &fla, &nDbl, &simTim, dblVal);
+      break;
+    }
+    retVal = writetoclientshm(shmfd, &fla, &nDbl, &simTim, dblVal);
+    if ( retVal )
+      break;
+    nMsg++;
+  }
+  free(dblVal);
+  return retVal ? retVal : nMsg;
+}
+
+int closeshm(int *shmfd){
+  shmHeader *hdr;
+  shmHandle *h = shmgethandle(shmfd);
+  if ( h == NULL )
+    return -1;
+  hdr = (shmHeader *)h->base;
+  shmstore(&hdr->attached[h->side], 0);
+  // wake a peer that waits on this side
+  shmwake(&hdr->ring[0].head);
+  shmwake(&hdr->ring[0].tail);
+  shmwake(&hdr->ring[1].head);
+  shmwake(&hdr->ring[1].tail);
+  munmap(h->base, h->size);
+  close(h->fd);
+  if ( h->side == SHM_SERVER )
+    unlink(h->fileName);
+  h->fd = -1;
+  *shmfd = -1;
+  return 0;
+}
+
+#endif /************* End of POSIX ********/
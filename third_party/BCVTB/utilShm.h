@@ -0,0 +1,180 @@
+// Methods for interfacing clients using a memory-mapped file.
+
+///////////////////////////////////////////////////////
+/// \file   utilShm.h
+///
+/// \brief  Methods for interfacing clients
+///         using a memory-mapped ring buffer.
+///
+/// This file provides a shared memory alternative to the
+/// socket methods in \c utilSocket.h for a peer that runs on
+/// the same computer. The client (EnergyPlus) calls
+/// \c establishclientshm() once, \c exchangedoubleswithshm()
+/// in each time step and \c sendclientmessageshm() to report
+/// the end of the simulation or an error, with the same
+/// arguments and flags as the corresponding socket methods.
+/// The peer creates the file with \c establishservershm() and
+/// uses \c readfromclientshm() and \c writetoclientshm(), or
+/// \c loopbackshm() which returns every message unchanged
+/// and is used for testing.
+///
+/// The values are exchanged in binary, so the double values
+/// are not converted to and from text as in the socket
+/// messages, and a whole vector of values is passed in one
+/// slot.
+///
+/// Layout of the memory-mapped file (native byte order):
+///
+///   offset  size  content
+///   0       4     magic number 0x4D535045 ("EPSM")
+///   4       4     layout version (1)
+///   8       4     number of slots per ring, nSlo
+///   12      4     maximum number of doubles per slot, nDblMax
+///   16      4     slot size in bytes, sloSiz
+///   20      8     attached flags, client and server (1 = attached)
+///   64      64    ring 0 (client to server) control block
+///   128     64    ring 1 (server to client) control block
+///   192           ring 0 slots, then ring 1 slots, nSlo * sloSiz bytes each
+///
+/// A ring control block holds the number of slots written
+/// (head), the number of slots read (tail) and the number of
+/// processes waiting on the ring, as 32 bit unsigned integers.
+/// Message \c n is stored in slot <tt>n % nSlo</tt>. A slot holds the
+/// communication flag (int32), the number of doubles (int32),
+/// the simulation time (double) and the double values.
+/// sloSiz is a multiple of 64 bytes.
+///
+/// A process waiting for a ring spins and yields briefly and then sleeps on
+/// the head or tail word; on Linux this is a futex wait, elsewhere
+/// a short sleep. The writer wakes the sleepers after it has
+/// advanced the head or tail. A wait ends with an error if the
+/// other side detached with \c closeshm().
+///
+/// Configuration file of the client, e.g. \c shm.cfg:
+/// \code
+/// <?xml version="1.0" encoding="ISO-8859-1"?>
+/// <BCVTB-client>
+///   <ipc>
+///     <sharedmemory file="/dev/shm/eplus.shm"/>
+///   </ipc>
+/// </BCVTB-client>
+/// \endcode
+///
+/// The methods are not available on Windows, where they return -1.
+///
+/// \sa establishclientshm
+/// \sa exchangedoubleswithshm
+/// \sa closeshm
+///
+///////////////////////////////////////////////////////
+#ifndef _UTILSHM_H_
+#define _UTILSHM_H_
+
+/// Magic number at the start of the memory-mapped file ("EPSM").
+#define SHM_MAGIC 0x4D535045
+/// Version of the layout of the memory-mapped file.
+#define SHM_VERSION 1
+/// Number of slots in each ring.
+#define SHM_NSLOTS 4
+
+/////////////////////////////////////////////////////////////////
+/// Gets the name of the memory-mapped file.
+///
+/// This method parses the xml file for the shared memory file name.
+/// \param docname Name of xml file.
+/// \param fileName The file name will be written to this argument.
+/// \return 0 if successful, or -1 if an error occured.
+int getshmfilename(const char *const docname, char *const fileName);
+
+/////////////////////////////////////////////////////////////////
+/// Creates the memory-mapped file and attaches to it as server.
+///
+/// An existing file is overwritten.
+/// \param fileName Name of the memory-mapped file.
+/// \param nDblMax Maximum number of double values in one message.
+/// \return The shared memory descriptor, or a negative value if an error occured.
+int establishservershm(const char *const fileName, const int nDblMax);
+
+/////////////////////////////////////////////////////////////////
+/// Attaches to the memory-mapped file as client.
+///
+/// \param docname Name of xml file that contains the shared memory information.
+/// \return The shared memory descriptor, or a negative value if an error occured.
+int establishclientshm(const char *const docname);
+
+/////////////////////////////////////////////////////////////////
+/// Writes a message from the client to the server and
+/// reads the reply.
+///
+///\param shmfd Shared memory descriptor.
+///\param flaWri Communication flag to write.
+///\param flaRea Communication flag read.
+///\param nDblWri Number of double values to write.
+///\param nDblRea Number of double values read.
+///\param simTimWri Current simulation time in seconds to write.
+///\param dblValWri Double values to write.
+///\param simTimRea Current simulation time in seconds read.
+///\param dblValRea Double values read.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int exchangedoubleswithshm(const int *shmfd,
+			   const int *flaWri, int *flaRea,
+			   const int *nDblWri,
+			   int *nDblRea,
+			   double *simTimWri,
+			   double dblValWri[],
+			   double *simTimRea,
+			   double dblValRea[]);
+
+/////////////////////////////////////////////////////////////////
+/// Sends a communication flag from the client to the server and
+/// waits for the acknowledgement.
+///
+/// Waiting for the acknowledgement ends after a few seconds if
+/// the server does not reply.
+///\param shmfd Shared memory descriptor.
+///\param flaWri Communication flag to write.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int sendclientmessageshm(const int *shmfd, const int *flaWri);
+
+/////////////////////////////////////////////////////////////////
+/// Reads a message from the client.
+///
+///\param shmfd Shared memory descriptor.
+///\param flaRea Communication flag read.
+///\param nDblRea Number of double values read.
+///\param simTimRea Simulation time in seconds read.
+///\param dblValRea Double values read.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int readfromclientshm(const int *shmfd, int *flaRea, int *nDblRea,
+		      double *simTimRea, double dblValRea[]);
+
+/////////////////////////////////////////////////////////////////
+/// Writes a message to the client.
+///
+///\param shmfd Shared memory descriptor.
+///\param flaWri Communication flag to write.
+///\param nDblWri Number of double values to write.
+///\param simTimWri Simulation time in seconds to write.
+///\param dblValWri Double values to write.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int writetoclientshm(const int *shmfd, const int *flaWri, const int *nDblWri,
+		     double *simTimWri, double dblValWri[]);
+
+/////////////////////////////////////////////////////////////////
+/// Runs a loopback server.
+///
+/// Every message from the client is returned unchanged until
+/// the client sends a nonzero flag, which is acknowledged.
+///\param shmfd Shared memory descriptor of the server.
+///\return The number of messages returned, or a negative value if an error occured.
+int loopbackshm(const int *shmfd);
+
+/////////////////////////////////////////////////////////////////
+/// Detaches from the memory-mapped file.
+///
+/// The server also removes the file.
+///\param shmfd Shared memory descriptor, set to -1.
+///\return 0 if no error occurred.
+int closeshm(int *shmfd);
+
+#endif /* _UTILSHM_H_ */
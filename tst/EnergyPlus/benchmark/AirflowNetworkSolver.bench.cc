@@ -0,0 +1,83 @@
+// EnergyPlus::AirflowNetworkSolver Benchmarks
+
+// C++ Headers
+#include <algorithm>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/AirflowNetworkSolver.hh>
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::AirflowNetworkSolver;
+
+namespace {
+
+	// Symmetric, diagonally dominant banded matrix in the skyline storage used by FACSKY and SLVSKY:
+	// the above-diagonal part of column k is stored top down in AU( IK( k ) ) to AU( IK( k + 1 ) - 1 ).
+	struct SkylineSystem
+	{
+		int NEQ;
+		Array1D_int IK;
+		Array1D< Real64 > AU;
+		Array1D< Real64 > AD;
+		Array1D< Real64 > AL;
+		Array1D< Real64 > B;
+
+		SkylineSystem(
+			int const NumNodes,
+			int const BandWidth
+		) :
+			NEQ( NumNodes ),
+			IK( NumNodes + 1 ),
+			AD( NumNodes, Real64( 2 * BandWidth + 1 ) ),
+			B( NumNodes )
+		{
+			IK( 1 ) = 1;
+			for ( int k = 1; k <= NEQ; ++k ) {
+				IK( k + 1 ) = IK( k ) + std::min( k - 1, BandWidth );
+			}
+			AU.dimension( IK( NEQ + 1 ), -1.0 );
+			AL.dimension( IK( NEQ + 1 ), -1.0 );
+			auto const b( InputSequence( NEQ, -1.0, 1.0 ) );
+			for ( int k = 1; k <= NEQ; ++k ) B( k ) = b[ k - 1 ];
+		}
+	};
+
+}
+
+TEST( AirflowNetworkSolverBenchmark, SkylineSolver )
+{
+	int const NetworkNumOfNodesSave( NetworkNumOfNodes );
+
+	// Small networks from a few zones up to a large multizone building with a duct system
+	for ( int const NumNodes : { 20, 100, 500 } ) {
+		NetworkNumOfNodes = NumNodes;
+		SkylineSystem const System( NumNodes, 8 );
+		std::string const Size( std::to_string( NumNodes ) );
+
+		SkylineSystem Factored( System );
+		FACSKY( Factored.AU, Factored.AD, Factored.AL, Factored.IK, NumNodes, 0 );
+		Array1D< Real64 > B( System.B );
+
+		RunBenchmark( "AirflowNetworkSolver/FACSKY/" + Size, [ & ]() {
+			Factored.AU = System.AU;
+			Factored.AD = System.AD;
+			FACSKY( Factored.AU, Factored.AD, Factored.AL, Factored.IK, NumNodes, 0 );
+			KeepResult( Factored.AD( NumNodes ) );
+		} );
+		RunBenchmark( "AirflowNetworkSolver/SLVSKY/" + Size, [ & ]() {
+			B = System.B;
+			SLVSKY( Factored.AU, Factored.AD, Factored.AL, B, Factored.IK, NumNodes, 0 );
+			KeepResult( B( 1 ) );
+		} );
+	}
+
+	NetworkNumOfNodes = NetworkNumOfNodesSave;
+}
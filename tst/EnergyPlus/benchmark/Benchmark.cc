@@ -0,0 +1,160 @@
+// C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+// JSON Headers
+#include <json/json.h>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+
+namespace EnergyPlus {
+
+namespace Benchmark {
+
+	// Data
+	Real64 MinTime( 0.1 ); // minimum time of one repetition {s}
+	int Repetitions( 5 ); // number of timed repetitions
+	Real64 volatile Sink( 0.0 ); // receives the benchmark results, see KeepResult
+
+	std::vector< BenchmarkResult > Results;
+
+	// Functions
+
+	BenchmarkResult const &
+	MeasureBenchmark(
+		std::string const & Name,
+		std::function< void( std::size_t const ) > const & Batch
+	)
+	{
+		// Times Batch( n ) for a batch size n that takes at least MinTime, Repetitions times
+		using Clock = std::chrono::steady_clock;
+		std::size_t const MaxIterations( 1000000000 );
+
+		// Find the batch size, this also warms up the caches
+		std::size_t n( 1 );
+		while ( true ) {
+			auto const start( Clock::now() );
+			Batch( n );
+			Real64 const elapsed( std::chrono::duration< Real64 >( Clock::now() - start ).count() );
+			if ( elapsed >= MinTime || n >= MaxIterations ) break;
+			// Grow by at most 10 times, aiming at 1.4 MinTime for the next try
+			Real64 const factor( elapsed > 0.0 ? std::min( 10.0, std::max( 2.0, 1.4 * MinTime / elapsed ) ) : 10.0 );
+			n = std::min( MaxIterations, static_cast< std::size_t >( n * factor ) );
+		}
+
+		std::vector< Real64 > realTimes;
+		std::vector< Real64 > cpuTimes;
+		for ( int rep = 1; rep <= std::max( 1, Repetitions ); ++rep ) {
+			std::clock_t const cpuStart( std::clock() );
+			auto const start( Clock::now() );
+			Batch( n );
+			auto const stop( Clock::now() );
+			std::clock_t const cpuStop( std::clock() );
+			realTimes.push_back( std::chrono::duration< Real64, std::nano >( stop - start ).count() / n );
+			cpuTimes.push_back( 1.0e9 * ( cpuStop - cpuStart ) / CLOCKS_PER_SEC / n );
+		}
+
+		BenchmarkResult result;
+		result.Name = Name;
+		result.Iterations = n;
+		result.Repetitions = static_cast< int >( realTimes.size() );
+		Real64 sum( 0.0 );
+		for ( auto const t : realTimes ) sum += t;
+		result.RealTimeMean = sum / realTimes.size();
+		Real64 sumSq( 0.0 );
+		for ( auto const t : realTimes ) sumSq += ( t - result.RealTimeMean ) * ( t - result.RealTimeMean );
+		result.RealTimeStdDev = realTimes.size() > 1 ? std::sqrt( sumSq / ( realTimes.size() - 1 ) ) : 0.0;
+		result.RealTimeMin = *std::min_element( realTimes.begin(), realTimes.end() );
+		result.RealTimeMax = *std::max_element( realTimes.begin(), realTimes.end() );
+		// The median is robust to single repetitions disturbed by other processes
+		auto const median = []( std::vector< Real64 > v ) {
+			std::sort( v.begin(), v.end() );
+			std::size_t const m( v.size() / 2 );
+			return ( v.size() % 2 == 1 ) ? v[ m ] : 0.5 * ( v[ m - 1 ] + v[ m ] );
+		};
+		result.RealTime = median( realTimes );
+		result.CpuTime = median( cpuTimes );
+
+		std::cout << "[ BENCH    ] " << Name << ": " << result.RealTime << " ns (" << n << " iterations, " << result.Repetitions << " repetitions)" << std::endl;
+		Results.push_back( result );
+		return Results.back();
+	}
+
+	std::vector< Real64 >
+	InputSequence(
+		std::size_t const N,
+		Real64 const Low,
+		Real64 const High,
+		unsigned int const Seed
+	)
+	{
+		// Linear congruential generator, so that the values do not depend on the standard library
+		std::vector< Real64 > values( N );
+		unsigned long long state( Seed );
+		for ( auto & value : values ) {
+			state = ( 6364136223846793005ULL * state + 1442695040888963407ULL );
+			value = Low + ( High - Low ) * ( ( state >> 11 ) * ( 1.0 / 9007199254740992.0 ) );
+		}
+		return values;
+	}
+
+	bool
+	WriteResults( std::string const & FileName )
+	{
+		Json::Value root;
+		Json::Value & context( root[ "context" ] );
+		char date[ 32 ];
+		std::time_t const now( std::time( nullptr ) );
+		std::strftime( date, sizeof( date ), "%Y-%m-%dT%H:%M:%S", std::localtime( &now ) );
+		context[ "date" ] = date;
+		context[ "num_cpus" ] = std::thread::hardware_concurrency();
+#ifdef NDEBUG
+		context[ "library_build_type" ] = "release";
+#else
+		context[ "library_build_type" ] = "debug";
+#endif
+		context[ "min_time" ] = MinTime;
+		context[ "repetitions" ] = Repetitions;
+
+		Json::Value & benchmarks( root[ "benchmarks" ] );
+		benchmarks = Json::Value( Json::arrayValue );
+		for ( auto const & result : Results ) {
+			Json::Value benchmark;
+			benchmark[ "name" ] = result.Name;
+			benchmark[ "iterations" ] = Json::UInt64( result.Iterations );
+			benchmark[ "repetitions" ] = result.Repetitions;
+			benchmark[ "real_time" ] = result.RealTime;
+			benchmark[ "real_time_min" ] = result.RealTimeMin;
+			benchmark[ "real_time_max" ] = result.RealTimeMax;
+			benchmark[ "real_time_mean" ] = result.RealTimeMean;
+			benchmark[ "real_time_stddev" ] = result.RealTimeStdDev;
+			benchmark[ "cpu_time" ] = result.CpuTime;
+			benchmark[ "time_unit" ] = "ns";
+			benchmarks.append( benchmark );
+		}
+
+		Json::StreamWriterBuilder builder;
+		builder[ "indentation" ] = "  ";
+		std::string const json( Json::writeString( builder, root ) );
+		if ( FileName.empty() ) {
+			std::cout << json << std::endl;
+			return true;
+		}
+		std::ofstream out( FileName );
+		if ( ! out ) {
+			std::cerr << "energyplus_benchmarks: Could not open \"" << FileName << "\" for output." << std::endl;
+			return false;
+		}
+		out << json << std::endl;
+		return static_cast< bool >( out );
+	}
+
+} // Benchmark
+
+} // EnergyPlus
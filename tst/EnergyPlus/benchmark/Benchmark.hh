@@ -0,0 +1,105 @@
+#ifndef EnergyPlusBenchmark_hh_INCLUDED
+#define EnergyPlusBenchmark_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace Benchmark {
+
+	// Benchmark driver for the energyplus_benchmarks target.
+	// Each benchmark is a gtest test that sets up the module state and calls RunBenchmark for the kernel.
+	// The body is first run in batches of growing size until a batch takes MinTime, then that batch size is
+	// timed Repetitions times. The statistics over the repetitions are written as JSON by WriteResults.
+	// Inputs are taken from fixed tables (see InputSequence) so that every run times the same work.
+
+	// Data
+	extern Real64 MinTime; // minimum time of one repetition {s}
+	extern int Repetitions; // number of timed repetitions
+	extern Real64 volatile Sink; // receives the benchmark results, see KeepResult
+
+	struct BenchmarkResult
+	{
+		// Members
+		std::string Name; // Module/kernel name
+		std::size_t Iterations; // Iterations per repetition
+		int Repetitions; // Number of timed repetitions
+		Real64 RealTime; // Median wall time per iteration {ns}
+		Real64 RealTimeMin; // Minimum wall time per iteration {ns}
+		Real64 RealTimeMax; // Maximum wall time per iteration {ns}
+		Real64 RealTimeMean; // Mean wall time per iteration {ns}
+		Real64 RealTimeStdDev; // Standard deviation of wall time per iteration {ns}
+		Real64 CpuTime; // Median processor time per iteration {ns}
+
+		// Default Constructor
+		BenchmarkResult() :
+			Iterations( 0 ),
+			Repetitions( 0 ),
+			RealTime( 0.0 ),
+			RealTimeMin( 0.0 ),
+			RealTimeMax( 0.0 ),
+			RealTimeMean( 0.0 ),
+			RealTimeStdDev( 0.0 ),
+			CpuTime( 0.0 )
+		{}
+
+	};
+
+	extern std::vector< BenchmarkResult > Results;
+
+	// Functions
+
+	// Times Batch( n ), which runs the benchmark body n times, and stores the result
+	BenchmarkResult const &
+	MeasureBenchmark(
+		std::string const & Name,
+		std::function< void( std::size_t const ) > const & Batch
+	);
+
+	// Times Body() for the named benchmark
+	template< typename Body >
+	inline
+	BenchmarkResult const &
+	RunBenchmark(
+		std::string const & Name,
+		Body body
+	)
+	{
+		return MeasureBenchmark( Name, [ &body ]( std::size_t const n ) {
+			for ( std::size_t i = 0; i < n; ++i ) body();
+		} );
+	}
+
+	// Stores a value so that the computation of it is not optimized away
+	inline
+	void
+	KeepResult( Real64 const Value )
+	{
+		Sink = Value;
+	}
+
+	// Deterministic sequence of N values in [ Low, High ], the same in every run
+	std::vector< Real64 >
+	InputSequence(
+		std::size_t const N,
+		Real64 const Low,
+		Real64 const High,
+		unsigned int const Seed = 1u
+	);
+
+	// Writes the results as JSON to FileName, or to stdout if FileName is empty
+	bool
+	WriteResults( std::string const & FileName );
+
+} // Benchmark
+
+} // EnergyPlus
+
+#endif
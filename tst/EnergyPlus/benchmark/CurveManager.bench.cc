@@ -0,0 +1,194 @@
+// EnergyPlus::CurveManager Benchmarks
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::CurveManager;
+
+namespace {
+
+	std::size_t const NumInputs( 1024 ); // number of input points cycled through
+	int const NumTablePts( 8 ); // number of table points per independent variable
+
+	struct BenchmarkCurve
+	{
+		std::string Name;
+		int NumVars; // number of independent variables passed to CurveValue
+	};
+
+	// Sets up one curve of each type that CurveValue evaluates, with the independent variables limited to [ 0, 2 ].
+	// Curve:Functional:PressureDrop is evaluated by PressureCurveValue instead and is not included.
+	std::vector< BenchmarkCurve >
+	SetupCurves()
+	{
+		struct CurveSpec
+		{
+			std::string Name;
+			int ObjectType;
+			int CurveType;
+			int InterpolationType;
+			int NumVars;
+		};
+		std::vector< CurveSpec > const specs = {
+			{ "Linear", CurveType_Linear, Linear, EvaluateCurveToLimits, 1 },
+			{ "Quadratic", CurveType_Quadratic, Quadratic, EvaluateCurveToLimits, 1 },
+			{ "Cubic", CurveType_Cubic, Cubic, EvaluateCurveToLimits, 1 },
+			{ "Quartic", CurveType_Quartic, Quartic, EvaluateCurveToLimits, 1 },
+			{ "Exponent", CurveType_Exponent, Exponent, EvaluateCurveToLimits, 1 },
+			{ "ExponentialSkewNormal", CurveType_ExponentialSkewNormal, ExponentialSkewNormal, EvaluateCurveToLimits, 1 },
+			{ "Sigmoid", CurveType_Sigmoid, Sigmoid, EvaluateCurveToLimits, 1 },
+			{ "RectangularHyperbola1", CurveType_RectangularHyperbola1, RectangularHyperbola1, EvaluateCurveToLimits, 1 },
+			{ "RectangularHyperbola2", CurveType_RectangularHyperbola2, RectangularHyperbola2, EvaluateCurveToLimits, 1 },
+			{ "ExponentialDecay", CurveType_ExponentialDecay, ExponentialDecay, EvaluateCurveToLimits, 1 },
+			{ "DoubleExponentialDecay", CurveType_DoubleExponentialDecay, DoubleExponentialDecay, EvaluateCurveToLimits, 1 },
+			{ "BiQuadratic", CurveType_BiQuadratic, BiQuadratic, EvaluateCurveToLimits, 2 },
+			{ "BiCubic", CurveType_BiCubic, BiCubic, EvaluateCurveToLimits, 2 },
+			{ "QuadraticLinear", CurveType_QuadraticLinear, QuadraticLinear, EvaluateCurveToLimits, 2 },
+			{ "CubicLinear", CurveType_CubicLinear, CubicLinear, EvaluateCurveToLimits, 2 },
+			{ "FanPressureRise", CurveType_FanPressureRise, FanPressureRise, EvaluateCurveToLimits, 2 },
+			{ "TriQuadratic", CurveType_TriQuadratic, TriQuadratic, EvaluateCurveToLimits, 3 },
+			{ "ChillerPartLoadWithLift", CurveType_ChillerPartLoadWithLift, ChillerPartLoadWithLift, EvaluateCurveToLimits, 3 },
+			{ "QuadLinear", CurveType_QuadLinear, QuadLinear, EvaluateCurveToLimits, 4 },
+			{ "TableOneIV", CurveType_TableOneIV, Quadratic, LinearInterpolationOfTable, 1 },
+			{ "TableTwoIV", CurveType_TableTwoIV, BiQuadratic, LinearInterpolationOfTable, 2 },
+			{ "TableMultiIV1", CurveType_TableMultiIV, MultiVariableLookup, LagrangeInterpolationLinearExtrapolation, 1 },
+			{ "TableMultiIV2", CurveType_TableMultiIV, MultiVariableLookup, LagrangeInterpolationLinearExtrapolation, 2 },
+			{ "TableMultiIV3", CurveType_TableMultiIV, MultiVariableLookup, LagrangeInterpolationLinearExtrapolation, 3 }
+		};
+
+		NumCurves = static_cast< int >( specs.size() );
+		PerfCurve.allocate( NumCurves );
+		PerfCurveTableData.allocate( NumCurves );
+		TableLookup.allocate( NumCurves );
+		std::vector< BenchmarkCurve > curves;
+		for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) {
+			auto const & spec( specs[ CurveNum - 1 ] );
+			auto & curve( PerfCurve( CurveNum ) );
+			curve.Name = spec.Name;
+			curve.ObjectType = spec.ObjectType;
+			curve.CurveType = spec.CurveType;
+			curve.InterpolationType = spec.InterpolationType;
+			curve.Coeff1 = 0.9;
+			curve.Coeff2 = 0.2;
+			curve.Coeff3 = 0.5;
+			curve.Coeff4 = 0.3;
+			curve.Coeff5 = 0.05;
+			curve.Coeff6 = -0.04;
+			curve.Coeff7 = 0.01;
+			curve.Coeff8 = 0.02;
+			curve.Coeff9 = -0.01;
+			curve.Coeff10 = 0.03;
+			curve.Coeff11 = 0.005;
+			curve.Coeff12 = -0.002;
+			curve.Var1Min = curve.Var2Min = curve.Var3Min = curve.Var4Min = curve.Var5Min = 0.0;
+			curve.Var1Max = curve.Var2Max = curve.Var3Max = curve.Var4Max = curve.Var5Max = 2.0;
+			curve.CurveMin = 0.0;
+			curve.CurveMax = 10.0;
+			curve.CurveMinPresent = true;
+			curve.CurveMaxPresent = true;
+			if ( spec.CurveType == TriQuadratic ) {
+				curve.Tri2ndOrder.allocate( 1 );
+				auto & tri( curve.Tri2ndOrder( 1 ) );
+				tri.CoeffA0 = 0.9;
+				tri.CoeffA1 = 0.02;
+				tri.CoeffA2 = 0.1;
+				tri.CoeffA3 = -0.01;
+				tri.CoeffA4 = 0.05;
+				tri.CoeffA5 = 0.01;
+				tri.CoeffA6 = -0.03;
+				tri.CoeffA8 = 0.004;
+				tri.CoeffA12 = -0.002;
+				tri.CoeffA16 = 0.001;
+				tri.CoeffA26 = 0.0005;
+			}
+
+			if ( spec.InterpolationType == EvaluateCurveToLimits ) {
+				curves.push_back( { "CurveManager/CurveValue/" + spec.Name, spec.NumVars } );
+				continue;
+			}
+
+			// Tables of z = 1 + 0.5 x1 - 0.2 x1^2 + 0.3 x2 + 0.1 x1 x3 on equally spaced points over [ 0, 2 ]
+			curve.TableIndex = CurveNum;
+			curve.TableVariables = spec.NumVars;
+			auto & table( TableLookup( CurveNum ) );
+			table.NumIndependentVars = spec.NumVars;
+			table.InterpolationOrder = 2;
+			table.NumX1Vars = NumTablePts;
+			table.NumX2Vars = spec.NumVars >= 2 ? NumTablePts : 1;
+			table.NumX3Vars = spec.NumVars >= 3 ? NumTablePts : 1;
+			table.X1Var.allocate( table.NumX1Vars );
+			table.X2Var.allocate( table.NumX2Vars );
+			table.X3Var.allocate( table.NumX3Vars );
+			for ( int i = 1; i <= NumTablePts; ++i ) {
+				Real64 const x( 2.0 * ( i - 1 ) / ( NumTablePts - 1 ) );
+				table.X1Var( i ) = x;
+				if ( i <= table.NumX2Vars ) table.X2Var( i ) = x;
+				if ( i <= table.NumX3Vars ) table.X3Var( i ) = x;
+			}
+			table.TableLookupZData.allocate( 1, 1, table.NumX3Vars, table.NumX2Vars, table.NumX1Vars );
+			auto & tableData( PerfCurveTableData( CurveNum ) );
+			tableData.X1 = table.X1Var;
+			tableData.X2 = table.X2Var;
+			tableData.Y.allocate( table.NumX2Vars, table.NumX1Vars );
+			for ( int i3 = 1; i3 <= table.NumX3Vars; ++i3 ) {
+				for ( int i2 = 1; i2 <= table.NumX2Vars; ++i2 ) {
+					for ( int i1 = 1; i1 <= table.NumX1Vars; ++i1 ) {
+						Real64 const x1( table.X1Var( i1 ) );
+						Real64 const z( 1.0 + 0.5 * x1 - 0.2 * x1 * x1 + 0.3 * table.X2Var( i2 ) + 0.1 * x1 * table.X3Var( i3 ) );
+						table.TableLookupZData( 1, 1, i3, i2, i1 ) = z;
+						if ( i3 == 1 ) tableData.Y( i2, i1 ) = z;
+					}
+				}
+			}
+			curves.push_back( { "CurveManager/CurveValue/" + spec.Name, spec.NumVars } );
+		}
+		return curves;
+	}
+
+}
+
+TEST( CurveManagerBenchmark, CurveValue )
+{
+	auto const curves( SetupCurves() );
+	auto const X1( InputSequence( NumInputs, 0.0, 2.0, 1u ) );
+	auto const X2( InputSequence( NumInputs, 0.0, 2.0, 2u ) );
+	auto const X3( InputSequence( NumInputs, 0.0, 2.0, 3u ) );
+	auto const X4( InputSequence( NumInputs, 0.0, 2.0, 4u ) );
+
+	for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) {
+		auto const & curve( curves[ CurveNum - 1 ] );
+		std::size_t i( 0 );
+		if ( curve.NumVars == 1 ) {
+			RunBenchmark( curve.Name, [ & ]() {
+				KeepResult( CurveValue( CurveNum, X1[ i ] ) );
+				i = ( i + 1 ) % NumInputs;
+			} );
+		} else if ( curve.NumVars == 2 ) {
+			RunBenchmark( curve.Name, [ & ]() {
+				KeepResult( CurveValue( CurveNum, X1[ i ], X2[ i ] ) );
+				i = ( i + 1 ) % NumInputs;
+			} );
+		} else if ( curve.NumVars == 3 ) {
+			RunBenchmark( curve.Name, [ & ]() {
+				KeepResult( CurveValue( CurveNum, X1[ i ], X2[ i ], X3[ i ] ) );
+				i = ( i + 1 ) % NumInputs;
+			} );
+		} else {
+			RunBenchmark( curve.Name, [ & ]() {
+				KeepResult( CurveValue( CurveNum, X1[ i ], X2[ i ], X3[ i ], X4[ i ] ) );
+				i = ( i + 1 ) % NumInputs;
+			} );
+		}
+	}
+
+	PerfCurve.deallocate();
+	PerfCurveTableData.deallocate();
+	TableLookup.deallocate();
+	NumCurves = 0;
+}
@@ -0,0 +1,159 @@
+// EnergyPlus::ExternalInterface Benchmarks
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+#ifndef _WIN32
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// POSIX Headers
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// BCVTB Headers
+extern "C" {
+#include <BCVTB/utilShm.h>
+#include <BCVTB/utilSocket.h>
+}
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+
+namespace {
+
+	int const NumDoubles( 64 ); // values exchanged in each direction per time step
+
+	// Returns every line it reads on the first connection unchanged, like a peer that only echoes its inputs
+	void
+	SocketEchoServer( int const listenFD )
+	{
+		int const connFD( accept( listenFD, nullptr, nullptr ) );
+		if ( connFD < 0 ) return;
+		std::vector< char > buffer( 8192 );
+		std::string line;
+		ssize_t n;
+		while ( ( n = read( connFD, buffer.data(), buffer.size() ) ) > 0 ) {
+			line.append( buffer.data(), n );
+			std::string::size_type end;
+			while ( ( end = line.find( '\n' ) ) != std::string::npos ) {
+				std::string::size_type written( 0 );
+				while ( written <= end ) {
+					ssize_t const w( write( connFD, line.data() + written, end + 1 - written ) );
+					if ( w <= 0 ) break;
+					written += w;
+				}
+				line.erase( 0, end + 1 );
+			}
+		}
+		close( connFD );
+	}
+
+	void
+	RunExchangeBenchmark(
+		std::string const & Name,
+		int ( *Exchange )( const int *, const int *, int *, const int *, int *, double *, double[], double *, double[] ),
+		int const & ClientFD
+	)
+	{
+		int flaWri( 0 );
+		int flaRea( 0 );
+		int nDblWri( NumDoubles );
+		int nDblRea( 0 );
+		double simTimWri( 0.0 );
+		double simTimRea( 0.0 );
+		std::vector< double > dblValWri( InputSequence( NumDoubles, 15.0, 30.0 ) );
+		std::vector< double > dblValRea( NumDoubles );
+		int retVal( 0 );
+
+		RunBenchmark( Name, [ & ]() {
+			simTimWri += 60.0;
+			retVal |= Exchange( &ClientFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &simTimWri, dblValWri.data(), &simTimRea, dblValRea.data() );
+			KeepResult( simTimRea );
+		} );
+		EXPECT_EQ( 0, retVal );
+		EXPECT_EQ( NumDoubles, nDblRea );
+		EXPECT_EQ( simTimWri, simTimRea );
+	}
+
+}
+
+TEST( ExternalInterfaceBenchmark, SharedMemoryExchange )
+{
+	std::string const shmFilNam( "ExternalInterfaceBenchmark.shm" );
+	std::string const cfgFilNam( "ExternalInterfaceBenchmark.shm.cfg" );
+	{
+		std::ofstream cfg( cfgFilNam );
+		cfg << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n";
+		cfg << "<BCVTB-client>\n  <ipc>\n    <sharedmemory file=\"" << shmFilNam << "\"/>\n  </ipc>\n</BCVTB-client>\n";
+	}
+	int serverFD = establishservershm( shmFilNam.c_str(), NumDoubles );
+	ASSERT_GE( serverFD, 0 );
+	// The client is attached before the server thread starts, so a failure
+	// returns without a joinable thread
+	int clientFD = establishclientshm( cfgFilNam.c_str() );
+	if ( clientFD < 0 ) {
+		closeshm( &serverFD );
+		std::remove( cfgFilNam.c_str() );
+	}
+	ASSERT_GE( clientFD, 0 );
+	std::thread server( [ &serverFD ]() { loopbackshm( &serverFD ); } );
+
+	RunExchangeBenchmark( "ExternalInterface/ExchangeDoubles/SharedMemory", exchangedoubleswithshm, clientFD );
+
+	int const flaEnd( 1 );
+	sendclientmessageshm( &clientFD, &flaEnd );
+	server.join();
+	closeshm( &clientFD );
+	closeshm( &serverFD );
+	std::remove( cfgFilNam.c_str() );
+}
+
+TEST( ExternalInterfaceBenchmark, SocketExchange )
+{
+	int listenFD( socket( AF_INET, SOCK_STREAM, 0 ) );
+	ASSERT_GE( listenFD, 0 );
+	sockaddr_in addr = sockaddr_in();
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+	addr.sin_port = 0;
+	socklen_t addrLen( sizeof( addr ) );
+	ASSERT_EQ( 0, bind( listenFD, reinterpret_cast< sockaddr * >( &addr ), sizeof( addr ) ) );
+	ASSERT_EQ( 0, listen( listenFD, 1 ) );
+	ASSERT_EQ( 0, getsockname( listenFD, reinterpret_cast< sockaddr * >( &addr ), &addrLen ) );
+
+	std::string const cfgFilNam( "ExternalInterfaceBenchmark.socket.cfg" );
+	{
+		std::ofstream cfg( cfgFilNam );
+		cfg << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n";
+		cfg << "<BCVTB-client>\n  <ipc>\n    <socket port=\"" << ntohs( addr.sin_port ) << "\" hostname=\"localhost\"/>\n  </ipc>\n</BCVTB-client>\n";
+	}
+	// The listen backlog completes the connection before the server thread
+	// accepts it, so a failure returns without a joinable thread
+	int clientFD = establishclientsocket( cfgFilNam.c_str() );
+	if ( clientFD < 0 ) {
+		close( listenFD );
+		std::remove( cfgFilNam.c_str() );
+	}
+	ASSERT_GE( clientFD, 0 );
+	std::thread server( SocketEchoServer, listenFD );
+
+	RunExchangeBenchmark( "ExternalInterface/ExchangeDoubles/Socket", exchangedoubleswithsocket, clientFD );
+
+	closeipc( &clientFD );
+	server.join();
+	close( listenFD );
+	std::remove( cfgFilNam.c_str() );
+}
+
+#endif
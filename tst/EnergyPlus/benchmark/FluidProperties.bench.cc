@@ -0,0 +1,152 @@
+// EnergyPlus::FluidProperties Benchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FluidProperties.hh>
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::FluidProperties;
+
+namespace {
+
+	std::size_t const NumInputs( 1024 ); // number of input temperatures cycled through
+	std::string const CalledFrom( "FluidPropertiesBenchmark" );
+
+	// Sets up a glycol with property tables from 0 to 100 C in 5 C steps, similar to 30% propylene glycol
+	void
+	SetupGlycol()
+	{
+		int const NumPts( 21 );
+		NumOfGlycols = 1;
+		GlycolData.allocate( 1 );
+		GlycolErrorTracking.allocate( 1 );
+		auto & glycol( GlycolData( 1 ) );
+		glycol.Name = "BENCHMARKGLYCOL";
+		GlycolErrorTracking( 1 ).Name = glycol.Name;
+		glycol.CpDataPresent = glycol.RhoDataPresent = glycol.CondDataPresent = glycol.ViscDataPresent = true;
+		glycol.NumCpTempPts = glycol.NumRhoTempPts = glycol.NumCondTempPts = glycol.NumViscTempPts = NumPts;
+		glycol.CpTemps.allocate( NumPts );
+		glycol.CpValues.allocate( NumPts );
+		glycol.RhoTemps.allocate( NumPts );
+		glycol.RhoValues.allocate( NumPts );
+		glycol.CondTemps.allocate( NumPts );
+		glycol.CondValues.allocate( NumPts );
+		glycol.ViscTemps.allocate( NumPts );
+		glycol.ViscValues.allocate( NumPts );
+		for ( int i = 1; i <= NumPts; ++i ) {
+			Real64 const T( 5.0 * ( i - 1 ) );
+			glycol.CpTemps( i ) = glycol.RhoTemps( i ) = glycol.CondTemps( i ) = glycol.ViscTemps( i ) = T;
+			glycol.CpValues( i ) = 3900.0 + 2.5 * T;
+			glycol.RhoValues( i ) = 1030.0 - 0.3 * T - 0.003 * T * T;
+			glycol.CondValues( i ) = 0.45 + 0.0012 * T - 0.000005 * T * T;
+			glycol.ViscValues( i ) = 4.0 * std::exp( -0.025 * T ) + 0.2;
+		}
+		glycol.CpLowTempIndex = glycol.RhoLowTempIndex = glycol.CondLowTempIndex = glycol.ViscLowTempIndex = 1;
+		glycol.CpHighTempIndex = glycol.RhoHighTempIndex = glycol.CondHighTempIndex = glycol.ViscHighTempIndex = NumPts;
+		glycol.CpLowTempValue = glycol.RhoLowTempValue = glycol.CondLowTempValue = glycol.ViscLowTempValue = 0.0;
+		glycol.CpHighTempValue = glycol.RhoHighTempValue = glycol.CondHighTempValue = glycol.ViscHighTempValue = 100.0;
+	}
+
+	// Sets up a refrigerant with saturation tables from -40 to 60 C in 2 C steps, similar to R410A
+	void
+	SetupRefrigerant()
+	{
+		int const NumPts( 51 );
+		NumOfRefrigerants = 1;
+		RefrigData.allocate( 1 );
+		RefrigErrorTracking.allocate( 1 );
+		auto & refrig( RefrigData( 1 ) );
+		refrig.Name = "BENCHMARKREFRIG";
+		RefrigErrorTracking( 1 ).Name = refrig.Name;
+		refrig.NumPsPoints = NumPts;
+		refrig.PsTemps.allocate( NumPts );
+		refrig.PsValues.allocate( NumPts );
+		refrig.HTemps.allocate( NumPts );
+		refrig.HfValues.allocate( NumPts );
+		refrig.HfgValues.allocate( NumPts );
+		for ( int i = 1; i <= NumPts; ++i ) {
+			Real64 const T( -40.0 + 2.0 * ( i - 1 ) );
+			refrig.PsTemps( i ) = refrig.HTemps( i ) = T;
+			refrig.PsValues( i ) = 1000.0 * std::exp( 15.0 - 2600.0 / ( T + 273.15 ) );
+			refrig.HfValues( i ) = 200000.0 + 1500.0 * T;
+			refrig.HfgValues( i ) = 420000.0 + 200.0 * T;
+		}
+		refrig.PsLowTempIndex = refrig.PsLowPresIndex = refrig.HfLowTempIndex = refrig.HfgLowTempIndex = 1;
+		refrig.PsHighTempIndex = refrig.PsHighPresIndex = refrig.HfHighTempIndex = refrig.HfgHighTempIndex = NumPts;
+		refrig.PsLowTempValue = refrig.HfLowTempValue = refrig.HfgLowTempValue = -40.0;
+		refrig.PsHighTempValue = refrig.HfHighTempValue = refrig.HfgHighTempValue = 60.0;
+		refrig.PsLowPresValue = refrig.PsValues( 1 );
+		refrig.PsHighPresValue = refrig.PsValues( NumPts );
+	}
+
+}
+
+TEST( FluidPropertiesBenchmark, GlycolProperties )
+{
+	GetInput = false;
+	SetupGlycol();
+	std::string const Name( GlycolData( 1 ).Name );
+	auto const T( InputSequence( NumInputs, 1.0, 99.0 ) );
+	int GlycolIndex( 1 );
+	std::size_t i( 0 );
+
+	RunBenchmark( "FluidProperties/GetSpecificHeatGlycol", [ & ]() {
+		KeepResult( GetSpecificHeatGlycol( Name, T[ i ], GlycolIndex, CalledFrom ) );
+		i = ( i + 1 ) % NumInputs;
+	} );
+	RunBenchmark( "FluidProperties/GetDensityGlycol", [ & ]() {
+		KeepResult( GetDensityGlycol( Name, T[ i ], GlycolIndex, CalledFrom ) );
+		i = ( i + 1 ) % NumInputs;
+	} );
+	RunBenchmark( "FluidProperties/GetConductivityGlycol", [ & ]() {
+		KeepResult( GetConductivityGlycol( Name, T[ i ], GlycolIndex, CalledFrom ) );
+		i = ( i + 1 ) % NumInputs;
+	} );
+	RunBenchmark( "FluidProperties/GetViscosityGlycol", [ & ]() {
+		KeepResult( GetViscosityGlycol( Name, T[ i ], GlycolIndex, CalledFrom ) );
+		i = ( i + 1 ) % NumInputs;
+	} );
+
+	GlycolErrorTracking.deallocate();
+	GlycolData.deallocate();
+	NumOfGlycols = 0;
+	GetInput = true;
+}
+
+TEST( FluidPropertiesBenchmark, RefrigerantSaturationProperties )
+{
+	GetInput = false;
+	SetupRefrigerant();
+	std::string const Name( RefrigData( 1 ).Name );
+	auto const T( InputSequence( NumInputs, -39.0, 59.0 ) );
+	auto const Quality( InputSequence( NumInputs, 0.0, 1.0, 2u ) );
+	std::vector< Real64 > P( NumInputs );
+	int RefrigIndex( 1 );
+	for ( std::size_t i = 0; i < NumInputs; ++i ) P[ i ] = GetSatPressureRefrig( Name, T[ i ], RefrigIndex, CalledFrom );
+	std::size_t i( 0 );
+
+	RunBenchmark( "FluidProperties/GetSatPressureRefrig", [ & ]() {
+		KeepResult( GetSatPressureRefrig( Name, T[ i ], RefrigIndex, CalledFrom ) );
+		i = ( i + 1 ) % NumInputs;
+	} );
+	RunBenchmark( "FluidProperties/GetSatTemperatureRefrig", [ & ]() {
+		KeepResult( GetSatTemperatureRefrig( Name, P[ i ], RefrigIndex, CalledFrom ) );
+		i = ( i + 1 ) % NumInputs;
+	} );
+	RunBenchmark( "FluidProperties/GetSatEnthalpyRefrig", [ & ]() {
+		KeepResult( GetSatEnthalpyRefrig( Name, T[ i ], Quality[ i ], RefrigIndex, CalledFrom ) );
+		i = ( i + 1 ) % NumInputs;
+	} );
+
+	RefrigErrorTracking.deallocate();
+	RefrigData.deallocate();
+	NumOfRefrigerants = 0;
+	GetInput = true;
+}
@@ -0,0 +1,54 @@
+// EnergyPlus::General Benchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/General.hh>
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::General;
+
+namespace {
+
+	std::size_t const NumInputs( 1024 ); // number of targets cycled through
+
+	// Smooth monotonic residual, similar to the coil and controller residuals in the HVAC models
+	Real64
+	Residual(
+		Real64 const X,
+		Array1< Real64 > const & Par
+	)
+	{
+		return Par( 1 ) - ( X + 0.3 * std::tanh( 4.0 * ( X - 0.5 ) ) + 0.1 * X * X );
+	}
+
+}
+
+TEST( GeneralBenchmark, SolveRegulaFalsi )
+{
+	auto const Target( InputSequence( NumInputs, 0.1, 1.0 ) );
+	Array1D< Real64 > Par( 1 );
+	std::size_t i( 0 );
+	int SolFla( 0 );
+	Real64 X( 0.0 );
+
+	RunBenchmark( "General/SolveRegulaFalsi/Par", [ & ]() {
+		Par( 1 ) = Target[ i ];
+		SolveRegulaFalsi( 1.0e-8, 50, SolFla, X, Residual, 0.0, 1.0, Par );
+		KeepResult( X );
+		i = ( i + 1 ) % NumInputs;
+	} );
+	RunBenchmark( "General/SolveRegulaFalsi/Lambda", [ & ]() {
+		Real64 const T( Target[ i ] );
+		SolveRegulaFalsi( 1.0e-8, 50, SolFla, X, [ T ]( Real64 const Y ) { return T - ( Y + 0.3 * std::tanh( 4.0 * ( Y - 0.5 ) ) + 0.1 * Y * Y ); }, 0.0, 1.0 );
+		KeepResult( X );
+		i = ( i + 1 ) % NumInputs;
+	} );
+	EXPECT_GT( SolFla, 0 );
+}
@@ -0,0 +1,45 @@
+// EnergyPlus::HeatBalanceIntRadExchange Benchmarks
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+
+TEST( HeatBalanceIntRadExchangeBenchmark, CalcScriptF )
+{
+	// A shoebox zone and zones with more surfaces, each surface seeing the others in proportion to their area
+	for ( int const N : { 6, 20, 60 } ) {
+		Array1D< Real64 > Area( N );
+		Array1D< Real64 > Emissivity( N );
+		auto const A( InputSequence( N, 5.0, 50.0 ) );
+		auto const E( InputSequence( N, 0.1, 0.9, 2u ) );
+		Real64 TotalArea( 0.0 );
+		for ( int i = 1; i <= N; ++i ) {
+			Area( i ) = A[ i - 1 ];
+			Emissivity( i ) = E[ i - 1 ];
+			TotalArea += Area( i );
+		}
+		Array2D< Real64 > F( N, N );
+		for ( int i = 1; i <= N; ++i ) {
+			for ( int j = 1; j <= N; ++j ) {
+				F( j, i ) = ( i == j ) ? 0.0 : Area( j ) / ( TotalArea - Area( i ) );
+			}
+		}
+		Array2D< Real64 > ScriptF( N, N, 0.0 );
+
+		RunBenchmark( "HeatBalanceIntRadExchange/CalcScriptF/" + std::to_string( N ), [ & ]() {
+			CalcScriptF( N, Area, F, Emissivity, ScriptF );
+			KeepResult( ScriptF( 1, N ) );
+		} );
+	}
+}
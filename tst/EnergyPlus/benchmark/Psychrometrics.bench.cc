@@ -0,0 +1,132 @@
+// EnergyPlus::Psychrometrics Benchmarks
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/Psychrometrics.hh>
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::Psychrometrics;
+
+namespace {
+
+	std::size_t const NumStates( 1024 ); // number of air states cycled through
+
+	// Air states between -10 and 40 C at 10 to 90 percent relative humidity
+	struct AirStates
+	{
+		std::vector< Real64 > Tdb;
+		std::vector< Real64 > RH;
+		std::vector< Real64 > Pb;
+		std::vector< Real64 > W;
+		std::vector< Real64 > H;
+		std::vector< Real64 > Twb;
+
+		AirStates() :
+			Tdb( InputSequence( NumStates, -10.0, 40.0, 1u ) ),
+			RH( InputSequence( NumStates, 0.1, 0.9, 2u ) ),
+			Pb( InputSequence( NumStates, 95000.0, 103000.0, 3u ) ),
+			W( NumStates ),
+			H( NumStates ),
+			Twb( NumStates )
+		{
+			for ( std::size_t i = 0; i < NumStates; ++i ) {
+				W[ i ] = PsyWFnTdbRhPb( Tdb[ i ], RH[ i ], Pb[ i ] );
+				H[ i ] = PsyHFnTdbW( Tdb[ i ], W[ i ] );
+				Twb[ i ] = PsyTwbFnTdbWPb( Tdb[ i ], W[ i ], Pb[ i ] );
+			}
+		}
+	};
+
+}
+
+TEST( PsychrometricsBenchmark, MoistAirProperties )
+{
+	InitializePsychRoutines();
+	AirStates const s;
+	std::size_t i( 0 );
+
+	RunBenchmark( "Psychrometrics/PsyRhoAirFnPbTdbW", [ & ]() {
+		KeepResult( PsyRhoAirFnPbTdbW( s.Pb[ i ], s.Tdb[ i ], s.W[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyHFnTdbW", [ & ]() {
+		KeepResult( PsyHFnTdbW( s.Tdb[ i ], s.W[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyCpAirFnWTdb", [ & ]() {
+		KeepResult( PsyCpAirFnWTdb( s.W[ i ], s.Tdb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyTdbFnHW", [ & ]() {
+		KeepResult( PsyTdbFnHW( s.H[ i ], s.W[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyVFnTdbWPb", [ & ]() {
+		KeepResult( PsyVFnTdbWPb( s.Tdb[ i ], s.W[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+}
+
+TEST( PsychrometricsBenchmark, SaturationProperties )
+{
+	InitializePsychRoutines();
+	AirStates const s;
+	std::size_t i( 0 );
+
+	RunBenchmark( "Psychrometrics/PsyPsatFnTemp", [ & ]() {
+		KeepResult( PsyPsatFnTemp( s.Tdb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+#ifdef EP_cache_PsyPsatFnTemp
+	RunBenchmark( "Psychrometrics/PsyPsatFnTemp_raw", [ & ]() {
+		KeepResult( PsyPsatFnTemp_raw( s.Tdb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+#endif
+	RunBenchmark( "Psychrometrics/PsyTsatFnPb", [ & ]() {
+		KeepResult( PsyTsatFnPb( 0.05 * s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyTsatFnHPb", [ & ]() {
+		KeepResult( PsyTsatFnHPb( s.H[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+}
+
+TEST( PsychrometricsBenchmark, HumidityProperties )
+{
+	InitializePsychRoutines();
+	AirStates const s;
+	std::size_t i( 0 );
+
+	RunBenchmark( "Psychrometrics/PsyWFnTdbRhPb", [ & ]() {
+		KeepResult( PsyWFnTdbRhPb( s.Tdb[ i ], s.RH[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyRhFnTdbWPb", [ & ]() {
+		KeepResult( PsyRhFnTdbWPb( s.Tdb[ i ], s.W[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyTdpFnWPb", [ & ]() {
+		KeepResult( PsyTdpFnWPb( s.W[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyWFnTdbTwbPb", [ & ]() {
+		KeepResult( PsyWFnTdbTwbPb( s.Tdb[ i ], s.Twb[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+	RunBenchmark( "Psychrometrics/PsyTwbFnTdbWPb", [ & ]() {
+		KeepResult( PsyTwbFnTdbWPb( s.Tdb[ i ], s.W[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+#ifdef EP_cache_PsyTwbFnTdbWPb
+	RunBenchmark( "Psychrometrics/PsyTwbFnTdbWPb_raw", [ & ]() {
+		KeepResult( PsyTwbFnTdbWPb_raw( s.Tdb[ i ], s.W[ i ], s.Pb[ i ] ) );
+		i = ( i + 1 ) % NumStates;
+	} );
+#endif
+}
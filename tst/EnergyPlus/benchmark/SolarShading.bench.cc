@@ -0,0 +1,145 @@
+// EnergyPlus::SolarShading Benchmarks
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/SolarShading.hh>
+#include "Benchmark.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::SolarShading;
+
+namespace {
+
+	int const NumVertices( 8 ); // vertices of the shadow figure
+
+	// Allocates the homogeneous coordinate arrays the same way InitSolarCalculations and AllocateModuleArrays do
+	void
+	SetupPolygonArrays()
+	{
+		DataSurfaces::MaxVerticesPerSurface = NumVertices;
+		MaxHCS = 15;
+		MaxHCV = ( ( ( std::max( 15, NumVertices ) + 16 ) / 16 ) * 16 ) - 1;
+		HCA.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCB.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCC.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCX.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCY.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCAREA.dimension( 2 * MaxHCS, 0.0 );
+		HCNS.dimension( 2 * MaxHCS, 0 );
+		HCNV.dimension( 2 * MaxHCS, 0 );
+		HCT.dimension( 2 * MaxHCS, 0.0 );
+		MAXHCArrayBounds = 2 * ( NumVertices + 1 );
+		MAXHCArrayIncrement = NumVertices + 1;
+		XTEMP.dimension( 2 * ( NumVertices + 1 ), 0.0 );
+		YTEMP.dimension( 2 * ( NumVertices + 1 ), 0.0 );
+		XVC.dimension( NumVertices + 1, 0.0 );
+		XVS.dimension( NumVertices + 1, 0.0 );
+		YVC.dimension( NumVertices + 1, 0.0 );
+		YVS.dimension( NumVertices + 1, 0.0 );
+		ZVC.dimension( NumVertices + 1, 0.0 );
+		ATEMP.dimension( 2 * ( NumVertices + 1 ), 0.0 );
+		BTEMP.dimension( 2 * ( NumVertices + 1 ), 0.0 );
+		CTEMP.dimension( 2 * ( NumVertices + 1 ), 0.0 );
+		XTEMP1.dimension( 2 * ( NumVertices + 1 ), 0.0 );
+		YTEMP1.dimension( 2 * ( NumVertices + 1 ), 0.0 );
+	}
+
+	void
+	DeallocatePolygonArrays()
+	{
+		HCA.deallocate();
+		HCB.deallocate();
+		HCC.deallocate();
+		HCX.deallocate();
+		HCY.deallocate();
+		HCAREA.deallocate();
+		HCNS.deallocate();
+		HCNV.deallocate();
+		HCT.deallocate();
+		XTEMP.deallocate();
+		YTEMP.deallocate();
+		XVC.deallocate();
+		XVS.deallocate();
+		YVC.deallocate();
+		YVS.deallocate();
+		ZVC.deallocate();
+		ATEMP.deallocate();
+		BTEMP.deallocate();
+		CTEMP.deallocate();
+		XTEMP1.deallocate();
+		YTEMP1.deallocate();
+	}
+
+	// Figure 1 is a 4 m x 3 m window, figures 2 to 4 are octagonal shadows that partly overlap it,
+	// cover it and miss it.  The vertices are put in clockwise order as HTRANS1 expects.
+	void
+	SetupFigures()
+	{
+		Real64 const Pi( 4.0 * std::atan( 1.0 ) );
+		Real64 const RectX[] = { 0.0, 0.0, 4.0, 4.0 };
+		Real64 const RectY[] = { 0.0, 3.0, 3.0, 0.0 };
+		for ( int N = 1; N <= 4; ++N ) {
+			XVS( N ) = RectX[ N - 1 ];
+			YVS( N ) = RectY[ N - 1 ];
+		}
+		HTRANS1( 1, 4 );
+
+		Real64 const CenterX[] = { 3.5, 2.0, 9.0 };
+		Real64 const CenterY[] = { 2.5, 1.5, 9.0 };
+		Real64 const Radius[] = { 1.5, 6.0, 1.0 };
+		for ( int NS = 2; NS <= 4; ++NS ) {
+			for ( int N = 1; N <= NumVertices; ++N ) {
+				Real64 const Angle( -2.0 * Pi * ( N - 1 ) / NumVertices );
+				XVS( N ) = CenterX[ NS - 2 ] + Radius[ NS - 2 ] * std::cos( Angle );
+				YVS( N ) = CenterY[ NS - 2 ] + Radius[ NS - 2 ] * std::sin( Angle );
+			}
+			HTRANS1( NS, NumVertices );
+		}
+		for ( int NS = 1; NS <= 4; ++NS ) HCT( NS ) = 0.0; // opaque
+	}
+
+}
+
+TEST( SolarShadingBenchmark, PolygonOverlap )
+{
+	bool const SutherlandHodgmanSave( DataSystemVariables::SutherlandHodgman );
+	SetupPolygonArrays();
+	SetupFigures();
+
+	char const * const Cases[] = { "PartialOverlap", "FirstWithinSecond", "NoOverlap" };
+	for ( int Algorithm = 0; Algorithm <= 1; ++Algorithm ) {
+		DataSystemVariables::SutherlandHodgman = ( Algorithm == 1 );
+		std::string const Prefix( std::string( "SolarShading/DeterminePolygonOverlap/" ) + ( Algorithm == 1 ? "SutherlandHodgman/" : "ConvexWeilerAtherton/" ) );
+		for ( int NS2 = 2; NS2 <= 4; ++NS2 ) {
+			RunBenchmark( Prefix + Cases[ NS2 - 2 ], [ & ]() {
+				DeterminePolygonOverlap( 1, NS2, 5 );
+				KeepResult( OverlapStatus );
+			} );
+		}
+	}
+
+	DataSystemVariables::SutherlandHodgman = SutherlandHodgmanSave;
+	DeallocatePolygonArrays();
+}
+
+TEST( SolarShadingBenchmark, ShadowTransform )
+{
+	SetupPolygonArrays();
+	SetupFigures();
+
+	RunBenchmark( "SolarShading/HTRANS1", [ & ]() {
+		HTRANS1( 2, NumVertices );
+		KeepResult( HCAREA( 2 ) );
+	} );
+
+	DeallocatePolygonArrays();
+}
@@ -0,0 +1,46 @@
+// EnergyPlus Benchmark Driver
+
+// C++ Headers
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+
+// Google Test main with the benchmark options
+//   --benchmark_out=<file>         JSON output file (default energyplus_benchmarks.json, - for stdout)
+//   --benchmark_min_time=<s>       minimum time of one repetition (default 0.1)
+//   --benchmark_repetitions=<n>    number of timed repetitions (default 5)
+// Benchmarks are selected with --gtest_filter, e.g. --gtest_filter=Psychrometrics*
+int
+main( int argc, char **argv )
+{
+	using namespace EnergyPlus;
+
+	::testing::InitGoogleTest( &argc, argv );
+
+	std::string outFile( "energyplus_benchmarks.json" );
+	for ( int i = 1; i < argc; ++i ) {
+		std::string const arg( argv[ i ] );
+		auto const value = [ &arg ]() { return arg.substr( arg.find( '=' ) + 1 ); };
+		if ( arg.compare( 0, 16, "--benchmark_out=" ) == 0 ) {
+			outFile = value();
+			if ( outFile == "-" ) outFile.clear();
+		} else if ( arg.compare( 0, 21, "--benchmark_min_time=" ) == 0 ) {
+			Benchmark::MinTime = std::atof( value().c_str() );
+		} else if ( arg.compare( 0, 24, "--benchmark_repetitions=" ) == 0 ) {
+			Benchmark::Repetitions = std::atoi( value().c_str() );
+		} else {
+			std::cerr << "energyplus_benchmarks: Unknown argument \"" << arg << "\"." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	int const status( RUN_ALL_TESTS() );
+	if ( ! Benchmark::WriteResults( outFile ) ) return EXIT_FAILURE;
+	return status;
+}
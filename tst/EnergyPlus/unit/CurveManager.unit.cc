@@ -0,0 +1,60 @@
+// EnergyPlus::CurveManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+
+TEST( CurveManagerTest, TableLookupObjectThreeVars )
+{
+	ShowMessage( "Begin Test: CurveManagerTest, TableLookupObjectThreeVars" );
+
+	// Table of z = x + 2y + 3w on a 3 x 2 x 2 grid, linear interpolation
+	TableLookup.allocate( 1 );
+	auto & table( TableLookup( 1 ) );
+	table.NumIndependentVars = 3;
+	table.InterpolationOrder = 2;
+	table.NumX1Vars = 3;
+	table.X1Var.allocate( 3 );
+	table.X1Var = { 0.0, 1.0, 2.0 };
+	table.NumX2Vars = 2;
+	table.X2Var.allocate( 2 );
+	table.X2Var = { 0.0, 1.0 };
+	table.NumX3Vars = 2;
+	table.X3Var.allocate( 2 );
+	table.X3Var = { 0.0, 1.0 };
+	table.TableLookupZData.allocate( 1, 1, 2, 2, 3 );
+	for ( int iw = 1; iw <= 2; ++iw ) {
+		for ( int iy = 1; iy <= 2; ++iy ) {
+			for ( int ix = 1; ix <= 3; ++ix ) {
+				table.TableLookupZData( 1, 1, iw, iy, ix ) = table.X1Var( ix ) + 2.0 * table.X2Var( iy ) + 3.0 * table.X3Var( iw );
+			}
+		}
+	}
+
+	PerfCurve.allocate( 1 );
+	auto & curve( PerfCurve( 1 ) );
+	curve.TableIndex = 1;
+	curve.Var1Min = 0.0;
+	curve.Var1Max = 2.0;
+	curve.Var2Min = 0.0;
+	curve.Var2Max = 1.0;
+	curve.Var3Min = 0.0;
+	curve.Var3Max = 1.0;
+
+	EXPECT_NEAR( 0.5 + 1.0 + 0.75, TableLookupObject( 1, 0.5, 0.5, 0.25 ), 1.0e-12 );
+	EXPECT_NEAR( 2.0 + 2.0 + 3.0, TableLookupObject( 1, 2.0, 1.0, 1.0 ), 1.0e-12 );
+	// Repeated evaluation reuses the table work space
+	EXPECT_NEAR( 1.5 + 0.2 + 2.7, TableLookupObject( 1, 1.5, 0.1, 0.9 ), 1.0e-12 );
+	EXPECT_NEAR( 0.5 + 1.0 + 0.75, TableLookupObject( 1, 0.5, 0.5, 0.25 ), 1.0e-12 );
+	// Inputs are limited to the table range
+	EXPECT_NEAR( 2.0 + 0.0 + 3.0, TableLookupObject( 1, 5.0, -1.0, 1.0 ), 1.0e-12 );
+
+	PerfCurve.deallocate();
+	TableLookup.deallocate();
+}
@@ -0,0 +1,86 @@
+// EnergyPlus::DataTimings Unit Tests
+
+// C++ Headers
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// JSON Headers
+#include <json/json.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataTimings.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataTimings;
+
+TEST( DataTimingsTest, PhaseTimes )
+{
+	ShowMessage( "Begin Test: DataTimingsTest, PhaseTimes" );
+
+	PhaseElapsedTime = 0.0;
+	epStartPhase( PhaseWarmup );
+	std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+	epStartPhase( PhaseRunPeriod );
+	EXPECT_EQ( PhaseRunPeriod, CurrentPhase );
+	EXPECT_GE( PhaseElapsedTime( PhaseWarmup ), 0.015 );
+	EXPECT_EQ( 0.0, PhaseElapsedTime( PhaseRunPeriod ) );
+
+	// Restarting the current phase only brings its time up to date
+	std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+	Real64 const WarmupTime( PhaseElapsedTime( PhaseWarmup ) );
+	epStartPhase( PhaseRunPeriod );
+	EXPECT_EQ( WarmupTime, PhaseElapsedTime( PhaseWarmup ) );
+	EXPECT_GE( PhaseElapsedTime( PhaseRunPeriod ), 0.015 );
+
+	epStartPhase( PhaseGetInput );
+	PhaseElapsedTime = 0.0;
+}
+
+TEST( DataTimingsTest, WritePerformanceLog )
+{
+	ShowMessage( "Begin Test: DataTimingsTest, WritePerformanceLog" );
+
+	std::string const SaveFileName( DataStringGlobals::outputPerfLogFileName );
+	DataStringGlobals::outputPerfLogFileName = "DataTimingsTest.perflog";
+	PhaseZoneTimeSteps = 0;
+	PhaseHVACTimeSteps = 0;
+	PhaseHVACIterations = 0;
+	PhaseHVACMaxIterations = 0;
+	PhaseZoneTimeSteps( PhaseWarmup ) = 24;
+	PhaseZoneTimeSteps( PhaseRunPeriod ) = 96;
+	PhaseHVACTimeSteps( PhaseRunPeriod ) = 100;
+	PhaseHVACIterations( PhaseRunPeriod ) = 350;
+	PhaseHVACMaxIterations( PhaseRunPeriod ) = 2;
+
+	WritePerformanceLog( true );
+
+	Json::Value root;
+	{
+		std::ifstream perfLog( DataStringGlobals::outputPerfLogFileName );
+		ASSERT_TRUE( static_cast< bool >( perfLog ) );
+		perfLog >> root;
+	}
+	std::remove( DataStringGlobals::outputPerfLogFileName.c_str() );
+	DataStringGlobals::outputPerfLogFileName = SaveFileName;
+
+	EXPECT_TRUE( root[ "completed" ].asBool() );
+	EXPECT_EQ( 120, root[ "zone_time_steps" ].asInt() );
+	EXPECT_EQ( 350, root[ "hvac_iterations" ].asInt() );
+	EXPECT_EQ( 24, root[ "phases" ][ "warmup" ][ "zone_time_steps" ].asInt() );
+	EXPECT_EQ( 100, root[ "phases" ][ "run_period" ][ "hvac_time_steps" ].asInt() );
+	EXPECT_EQ( 2, root[ "phases" ][ "run_period" ][ "hvac_max_iterations" ].asInt() );
+	EXPECT_EQ( NumPhases, static_cast< int >( root[ "phases" ].size() ) );
+	EXPECT_GE( root[ "peak_memory" ].asInt64(), 0 );
+
+	PhaseZoneTimeSteps = 0;
+	PhaseHVACTimeSteps = 0;
+	PhaseHVACIterations = 0;
+	PhaseHVACMaxIterations = 0;
+}
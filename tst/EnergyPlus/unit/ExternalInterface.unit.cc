@@ -0,0 +1,88 @@
+// EnergyPlus::ExternalInterface Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+#ifndef _WIN32
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+// BCVTB Headers
+extern "C" {
+#include <BCVTB/utilShm.h>
+}
+
+// EnergyPlus Headers
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+
+TEST( ExternalInterfaceTest, SharedMemoryLoopback )
+{
+	ShowMessage( "Begin Test: ExternalInterfaceTest, SharedMemoryLoopback" );
+
+	std::string const shmFilNam( "ExternalInterfaceTest.shm" );
+	std::string const cfgFilNam( "ExternalInterfaceTest.shm.cfg" );
+	{
+		std::ofstream cfg( cfgFilNam );
+		cfg << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n";
+		cfg << "<BCVTB-client>\n  <ipc>\n    <sharedmemory file=\"" << shmFilNam << "\"/>\n  </ipc>\n</BCVTB-client>\n";
+	}
+
+	int const nDblMax( 3 );
+	int serverFD = establishservershm( shmFilNam.c_str(), nDblMax );
+	ASSERT_GE( serverFD, 0 );
+
+	// The client is attached before the server thread starts, so a failure
+	// returns without a joinable thread
+	int clientFD = establishclientshm( cfgFilNam.c_str() );
+	if ( clientFD < 0 ) {
+		closeshm( &serverFD );
+		std::remove( cfgFilNam.c_str() );
+	}
+	ASSERT_GE( clientFD, 0 );
+	int nMsg( -1 );
+	std::thread server( [ &serverFD, &nMsg ]() { nMsg = loopbackshm( &serverFD ); } );
+
+	// more exchanges than ring slots
+	int const nExc( 10 );
+	int flaWri( 0 );
+	int flaRea( -1 );
+	int nDblWri( nDblMax );
+	int nDblRea( 0 );
+	double simTimWri;
+	double simTimRea;
+	double dblValWri[ nDblMax ];
+	double dblValRea[ nDblMax ];
+	for ( int i = 0; i < nExc; ++i ) {
+		simTimWri = 60.0 * i;
+		for ( int j = 0; j < nDblMax; ++j ) dblValWri[ j ] = 0.5 * i + j;
+		EXPECT_EQ( 0, exchangedoubleswithshm( &clientFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &simTimWri, dblValWri, &simTimRea, dblValRea ) );
+		EXPECT_EQ( 0, flaRea );
+		EXPECT_EQ( nDblMax, nDblRea );
+		EXPECT_EQ( simTimWri, simTimRea );
+		for ( int j = 0; j < nDblMax; ++j ) EXPECT_EQ( dblValWri[ j ], dblValRea[ j ] );
+	}
+
+	// a message with more values than a slot holds is rejected
+	nDblWri = nDblMax + 1;
+	EXPECT_NE( 0, exchangedoubleswithshm( &clientFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &simTimWri, dblValWri, &simTimRea, dblValRea ) );
+
+	// end of simulation
+	int const flaEnd( 1 );
+	EXPECT_EQ( 0, sendclientmessageshm( &clientFD, &flaEnd ) );
+	server.join();
+	EXPECT_EQ( nExc, nMsg );
+
+	EXPECT_EQ( 0, closeshm( &clientFD ) );
+	EXPECT_EQ( -1, clientFD );
+	EXPECT_EQ( 0, closeshm( &serverFD ) );
+	std::ifstream shmFil( shmFilNam );
+	EXPECT_FALSE( shmFil.good() );
+	std::remove( cfgFilNam.c_str() );
+}
+
+#endif
@@ -0,0 +1,47 @@
+// EnergyPlus::FluidProperties Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FluidProperties.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::FluidProperties;
+
+TEST( FluidPropertiesTest, GetDensityGlycolInterpolation )
+{
+	ShowMessage( "Begin Test: FluidPropertiesTest, GetDensityGlycolInterpolation" );
+
+	GetInput = false;
+	NumOfGlycols = 1;
+	GlycolData.allocate( 1 );
+	GlycolErrorTracking.allocate( 1 );
+	auto & glycol( GlycolData( 1 ) );
+	glycol.Name = "TESTGLYCOL";
+	glycol.RhoDataPresent = true;
+	glycol.NumRhoTempPts = 5;
+	glycol.RhoTemps.allocate( 5 );
+	glycol.RhoTemps = { 0.0, 10.0, 20.0, 40.0, 80.0 };
+	glycol.RhoValues.allocate( 5 );
+	glycol.RhoValues = { 1000.0, 990.0, 970.0, 950.0, 900.0 };
+	glycol.RhoLowTempIndex = 1;
+	glycol.RhoHighTempIndex = 5;
+	glycol.RhoLowTempValue = 0.0;
+	glycol.RhoHighTempValue = 80.0;
+
+	int GlycolIndex( 1 );
+	std::string const CalledFrom( "FluidPropertiesTest" );
+	EXPECT_DOUBLE_EQ( 1000.0, GetDensityGlycol( glycol.Name, 0.0, GlycolIndex, CalledFrom ) );
+	EXPECT_DOUBLE_EQ( 995.0, GetDensityGlycol( glycol.Name, 5.0, GlycolIndex, CalledFrom ) );
+	EXPECT_DOUBLE_EQ( 990.0, GetDensityGlycol( glycol.Name, 10.0, GlycolIndex, CalledFrom ) );
+	EXPECT_DOUBLE_EQ( 960.0, GetDensityGlycol( glycol.Name, 30.0, GlycolIndex, CalledFrom ) );
+	EXPECT_DOUBLE_EQ( 925.0, GetDensityGlycol( glycol.Name, 60.0, GlycolIndex, CalledFrom ) );
+	EXPECT_DOUBLE_EQ( 900.0, GetDensityGlycol( glycol.Name, 80.0, GlycolIndex, CalledFrom ) );
+
+	GlycolErrorTracking.deallocate();
+	GlycolData.deallocate();
+	NumOfGlycols = 0;
+	GetInput = true;
+}
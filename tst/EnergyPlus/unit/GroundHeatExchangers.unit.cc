@@ -3,6 +3,9 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array.functions.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus/GroundHeatExchangers.hh>
 #include <EnergyPlus/DataPlant.hh>
@@ -257,3 +260,68 @@ TEST( SlinkyGroundHeatExchangerTest, CalcGroundHeatExchanger )
 	EXPECT_NEAR( 18.91819, thisGLHE.GFNC( 28 ), 0.0001 );
 
 }
+
+TEST( GroundHeatExchangerTest, PushHistory )
+{
+	ShowMessage( "Begin Test: GroundHeatExchangerTest, PushHistory" );
+
+	Array1D< Real64 > history( 4, 0.0 );
+	Array1D_int historyInt( 3, 0 );
+
+	for ( int i = 1; i <= 5; ++i ) {
+		Array1D< Real64 > const expected( eoshift( history, -1, Real64( i ) ) );
+		pushHistory( history, Real64( i ) );
+		for ( int j = 1; j <= 4; ++j ) {
+			EXPECT_DOUBLE_EQ( expected( j ), history( j ) );
+		}
+		pushHistory( historyInt, i );
+	}
+
+	EXPECT_DOUBLE_EQ( 5.0, history( 1 ) );
+	EXPECT_DOUBLE_EQ( 2.0, history( 4 ) );
+	EXPECT_EQ( 5, historyInt( 1 ) );
+	EXPECT_EQ( 3, historyInt( 3 ) );
+}
+
+TEST( VerticalGroundHeatExchangerTest, HourlyGFuncCache )
+{
+	ShowMessage( "Begin Test: VerticalGroundHeatExchangerTest, HourlyGFuncCache" );
+
+	// Initialization
+	GLHEVert thisGLHE;
+
+	thisGLHE.NPairs = 3;
+
+	thisGLHE.LNTTS.allocate( thisGLHE.NPairs );
+	thisGLHE.GFNC.allocate( thisGLHE.NPairs );
+
+	thisGLHE.LNTTS( 1 ) = -15.0;
+	thisGLHE.LNTTS( 2 ) = -5.0;
+	thisGLHE.LNTTS( 3 ) = 3.0;
+	thisGLHE.GFNC( 1 ) = -2.0;
+	thisGLHE.GFNC( 2 ) = 4.0;
+	thisGLHE.GFNC( 3 ) = 40.0;
+
+	thisGLHE.boreholeLength = 100.0;
+	thisGLHE.boreholeRadius = 0.06;
+	thisGLHE.gReferenceRatio = 0.0005;
+	thisGLHE.timeSSFactor = 1000.0;
+	thisGLHE.QnHr.dimension( 50, 0.0 );
+
+	int const rowQuarter = thisGLHE.getHourlyGFuncRow( 0.25 );
+	int const rowHalf = thisGLHE.getHourlyGFuncRow( 0.5 );
+	EXPECT_EQ( 1, rowQuarter );
+	EXPECT_EQ( 2, rowHalf );
+	EXPECT_EQ( rowQuarter, thisGLHE.getHourlyGFuncRow( 0.25 ) );
+	EXPECT_EQ( 2, thisGLHE.numHourlyGFuncOffsets );
+
+	for ( int I = 1; I <= 50; ++I ) {
+		EXPECT_DOUBLE_EQ( thisGLHE.getGFunc( ( 0.25 + I ) / thisGLHE.timeSSFactor ), thisGLHE.hourlyGFunc( rowQuarter, I ) );
+		EXPECT_DOUBLE_EQ( thisGLHE.getGFunc( ( 0.5 + I ) / thisGLHE.timeSSFactor ), thisGLHE.hourlyGFunc( rowHalf, I ) );
+	}
+
+	// A new steady state time invalidates the cached rows
+	thisGLHE.timeSSFactor = 2000.0;
+	EXPECT_EQ( 1, thisGLHE.getHourlyGFuncRow( 0.5 ) );
+	EXPECT_DOUBLE_EQ( thisGLHE.getGFunc( 10.5 / thisGLHE.timeSSFactor ), thisGLHE.hourlyGFunc( 1, 10 ) );
+}
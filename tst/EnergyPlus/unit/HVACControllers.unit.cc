@@ -0,0 +1,165 @@
+// EnergyPlus::HVACControllers Unit Tests
+
+// C++ Headers
+#include <algorithm>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataAirSystems.hh>
+#include <EnergyPlus/DataHVACControllers.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/DataRootFinder.hh>
+#include <EnergyPlus/HVACControllers.hh>
+#include <EnergyPlus/RootFinder.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataAirSystems;
+using namespace EnergyPlus::DataHVACControllers;
+using namespace EnergyPlus::DataLoopNode;
+using namespace EnergyPlus::DataPlant;
+using namespace EnergyPlus::DataRootFinder;
+using namespace EnergyPlus::HVACControllers;
+using namespace EnergyPlus::RootFinder;
+
+namespace {
+
+	// Air temperature leaving a heating coil as a function of the hot water flow rate
+	Real64
+	CoilLeavingAirTemp( Real64 const WaterFlowRate )
+	{
+		return 10.0 + 20.0 * WaterFlowRate;
+	}
+
+	// Solves controller 1 of air loop 1 the way SolveAirLoopControllers() does, evaluating
+	// CoilLeavingAirTemp() in place of the air loop, then saves and tracks the solution.
+	// Returns the number of controller iterations. Candidates receives the actuated values tried.
+	int
+	SolveController(
+		bool const FirstHVACIteration,
+		Real64 const SetPoint,
+		Real64 const MaxAvailActuated,
+		std::vector< Real64 > & Candidates
+	)
+	{
+		bool IsConvergedFlag( false );
+		bool IsUpToDateFlag( false );
+
+		ResetController( 1, FirstHVACIteration, false, IsConvergedFlag );
+		// Set in InitController()
+		ControllerProps( 1 ).MinAvailActuated = 0.0;
+		ControllerProps( 1 ).MaxAvailActuated = MaxAvailActuated;
+		ControllerProps( 1 ).SetPointValue = SetPoint;
+		ControllerProps( 1 ).IsSetPointDefinedFlag = true;
+
+		Candidates.clear();
+		for ( int Iter = 1; Iter <= 20; ++Iter ) {
+			ControllerProps( 1 ).ActuatedValue = ControllerProps( 1 ).NextActuatedValue;
+			ControllerProps( 1 ).SensedValue = CoilLeavingAirTemp( ControllerProps( 1 ).ActuatedValue );
+			ControllerProps( 1 ).DeltaSensed = ControllerProps( 1 ).SensedValue - ControllerProps( 1 ).SetPointValue;
+			CalcSimpleController( 1, FirstHVACIteration, IsConvergedFlag, IsUpToDateFlag, ControllerProps( 1 ).ControllerName );
+			if ( IsConvergedFlag ) break;
+			Candidates.push_back( ControllerProps( 1 ).NextActuatedValue );
+		}
+		EXPECT_TRUE( IsConvergedFlag );
+
+		SaveSimpleController( 1, FirstHVACIteration, IsConvergedFlag );
+		TrackAirLoopController( 1, 1 );
+
+		return ControllerProps( 1 ).NumCalcCalls;
+	}
+
+}
+
+TEST( HVACControllersTest, SeedFromPreviousSolution )
+{
+	ShowMessage( "Begin Test: HVACControllersTest, SeedFromPreviousSolution" );
+
+	// One hot water coil controller on one air loop, normal action, with the coil on the demand side
+	// of one plant loop
+	Node.allocate( 2 );
+	Node( 1 ).MassFlowRate = 1.0;
+	PlantLoop.allocate( 1 );
+	PlantLoop( 1 ).LoopSide.allocate( 2 );
+	PlantLoop( 1 ).LoopSide( DemandSide ).Branch.allocate( 1 );
+	ControllerProps.allocate( 1 );
+	ControllerProps( 1 ).ControllerName = "HW COIL CONTROLLER";
+	ControllerProps( 1 ).ControlVar = iTemperature;
+	ControllerProps( 1 ).ActuatorVar = iFlow;
+	ControllerProps( 1 ).Action = iNormalAction;
+	ControllerProps( 1 ).SensedNode = 1;
+	ControllerProps( 1 ).ActuatedNode = 2;
+	ControllerProps( 1 ).ActuatedNodePlantLoopNum = 1;
+	ControllerProps( 1 ).ActuatedNodePlantLoopSide = DemandSide;
+	ControllerProps( 1 ).ActuatedNodePlantLoopBranchNum = 1;
+	ControllerProps( 1 ).Offset = 0.001;
+	ControllerProps( 1 ).SolutionTrackers.DefinedFlag() = false;
+	ControllerProps( 1 ).SolutionTrackers.Mode() = iModeNone;
+	RootFinders.allocate( 1 );
+	SetupRootFinder( RootFinders( 1 ), iSlopeIncreasing, iMethodBrent, 0.0, 1.0e-6, ControllerProps( 1 ).Offset );
+	PrimaryAirSystem.allocate( 1 );
+	PrimaryAirSystem( 1 ).NumControllers = 1;
+	PrimaryAirSystem( 1 ).ControllerIndex.allocate( 1 );
+	PrimaryAirSystem( 1 ).ControllerIndex( 1 ) = 1;
+	AirLoopStats.allocate( 1 );
+	AirLoopStats( 1 ).ControllerStats.allocate( 1 );
+
+	std::vector< Real64 > Candidates;
+
+	// No previous solution: cold start from the min point, which saves the solution and the slope
+	int const FirstIterations = SolveController( true, 20.0, 1.0, Candidates );
+	EXPECT_FALSE( ControllerProps( 1 ).SeedFromPreviousSolutionFlag );
+	ASSERT_FALSE( Candidates.empty() );
+	EXPECT_DOUBLE_EQ( 0.0, Candidates.front() );
+	EXPECT_EQ( iModeActive, ControllerProps( 1 ).Mode );
+	EXPECT_NEAR( 0.5, ControllerProps( 1 ).NextActuatedValue, 1.0e-4 );
+	EXPECT_TRUE( ControllerProps( 1 ).SolutionTrackers( 1 ).DefinedFlag );
+	EXPECT_EQ( iModeActive, ControllerProps( 1 ).SolutionTrackers( 1 ).Mode );
+	EXPECT_NEAR( 20.0, ControllerProps( 1 ).SolutionTrackers( 1 ).Slope, 1.0e-6 );
+	Real64 const PreviousSolution = ControllerProps( 1 ).SolutionTrackers( 1 ).ActuatedValue;
+
+	// Warm start: seeded with the previous solution, then a Newton step with the saved slope
+	int const SeededIterations = SolveController( true, 21.0, 1.0, Candidates );
+	EXPECT_TRUE( ControllerProps( 1 ).SeedFromPreviousSolutionFlag );
+	ASSERT_EQ( 2u, Candidates.size() );
+	EXPECT_DOUBLE_EQ( PreviousSolution, Candidates[ 0 ] );
+	EXPECT_NEAR( 0.55, Candidates[ 1 ], 1.0e-4 );
+	EXPECT_EQ( iModeActive, ControllerProps( 1 ).Mode );
+	Real64 const SeededSolution = ControllerProps( 1 ).NextActuatedValue;
+
+	// Previous solution missing: the seed is discarded and the cold start reaches the same solution
+	ControllerProps( 1 ).SolutionTrackers( 1 ).DefinedFlag = false;
+	int const ColdIterations = SolveController( true, 21.0, 1.0, Candidates );
+	EXPECT_FALSE( ControllerProps( 1 ).SeedFromPreviousSolutionFlag );
+	ASSERT_FALSE( Candidates.empty() );
+	EXPECT_DOUBLE_EQ( 0.0, Candidates.front() );
+	EXPECT_NEAR( ControllerProps( 1 ).NextActuatedValue, SeededSolution, 1.0e-4 );
+	EXPECT_LT( SeededIterations, ColdIterations );
+
+	// Previous solution outside the current min/max range: the seed is discarded as well
+	ASSERT_GT( ControllerProps( 1 ).SolutionTrackers( 1 ).ActuatedValue, 0.4 );
+	int const RangeIterations = SolveController( true, 15.0, 0.4, Candidates );
+	EXPECT_FALSE( ControllerProps( 1 ).SeedFromPreviousSolutionFlag );
+	ASSERT_FALSE( Candidates.empty() );
+	EXPECT_DOUBLE_EQ( 0.0, Candidates.front() );
+	EXPECT_NEAR( 0.25, ControllerProps( 1 ).NextActuatedValue, 1.0e-4 );
+
+	// Only the warm start counts as a seeded call
+	auto const & ControllerStats( AirLoopStats( 1 ).ControllerStats( 1 ) );
+	EXPECT_EQ( 1, ControllerStats.NumSeededCalls );
+	EXPECT_EQ( SeededIterations, ControllerStats.TotSeededIterations );
+	EXPECT_EQ( 4, ControllerStats.NumCalls( iModeActive ) );
+	EXPECT_EQ( FirstIterations + SeededIterations + ColdIterations + RangeIterations, ControllerStats.TotIterations( iModeActive ) );
+	EXPECT_EQ( std::max( { FirstIterations, SeededIterations, ColdIterations, RangeIterations } ), ControllerStats.MaxIterations( iModeActive ) );
+
+	AirLoopStats.deallocate();
+	PrimaryAirSystem.deallocate();
+	RootFinders.deallocate();
+	ControllerProps.deallocate();
+	PlantLoop.deallocate();
+	Node.deallocate();
+}
@@ -0,0 +1,61 @@
+// EnergyPlus::HeatBalanceHAMTManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceHAMTManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceHAMTManager;
+
+TEST( HeatBalanceHAMTManagerTest, SolveCellBand )
+{
+	ShowMessage( "Begin Test: HeatBalanceHAMTManagerTest, SolveCellBand" );
+
+	// Four cells in a chain, solution ( 1, 2, 3, 4 )
+	bandsub.dimension( 5, 0.0 );
+	banddiag.dimension( 5, 0.0 );
+	bandsup.dimension( 5, 0.0 );
+	bandrhs.dimension( 5, 0.0 );
+
+	banddiag( 1 ) = 4.0;
+	bandsup( 1 ) = -1.0;
+	bandsub( 2 ) = -1.0;
+	banddiag( 2 ) = 4.0;
+	bandsup( 2 ) = -2.0;
+	bandsub( 3 ) = -2.0;
+	banddiag( 3 ) = 5.0;
+	bandsup( 3 ) = -1.0;
+	bandsub( 4 ) = -1.0;
+	banddiag( 4 ) = 3.0;
+
+	bandrhs( 1 ) = 4.0 * 1.0 - 1.0 * 2.0;
+	bandrhs( 2 ) = -1.0 * 1.0 + 4.0 * 2.0 - 2.0 * 3.0;
+	bandrhs( 3 ) = -2.0 * 2.0 + 5.0 * 3.0 - 1.0 * 4.0;
+	bandrhs( 4 ) = -1.0 * 3.0 + 3.0 * 4.0;
+	bandrhs( 5 ) = 99.0; // Outside the system, must be left alone
+
+	SolveCellBand( 4 );
+
+	EXPECT_NEAR( 1.0, bandrhs( 1 ), 1.0e-12 );
+	EXPECT_NEAR( 2.0, bandrhs( 2 ), 1.0e-12 );
+	EXPECT_NEAR( 3.0, bandrhs( 3 ), 1.0e-12 );
+	EXPECT_NEAR( 4.0, bandrhs( 4 ), 1.0e-12 );
+	EXPECT_DOUBLE_EQ( 99.0, bandrhs( 5 ) );
+
+	// Single cell
+	banddiag( 1 ) = 2.0;
+	bandrhs( 1 ) = 5.0;
+	SolveCellBand( 1 );
+	EXPECT_DOUBLE_EQ( 2.5, bandrhs( 1 ) );
+
+	bandsub.deallocate();
+	banddiag.deallocate();
+	bandsup.deallocate();
+	bandrhs.deallocate();
+}
@@ -0,0 +1,65 @@
+// EnergyPlus::HeatBalanceIntRadExchange Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+#include <EnergyPlus/DataViewFactorInformation.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+using namespace EnergyPlus::DataViewFactorInformation;
+
+TEST( HeatBalanceIntRadExchangeTest, ScriptFCache )
+{
+	ShowMessage( "Begin Test: HeatBalanceIntRadExchangeTest, ScriptFCache" );
+
+	int const N( 3 );
+	ZoneInfo.allocate( 1 );
+	auto & zone_info( ZoneInfo( 1 ) );
+	zone_info.NumOfSurfaces = N;
+	zone_info.Area.dimension( N, 10.0 );
+	zone_info.F.dimension( N, N, 0.5 );
+	for ( int i = 1; i <= N; ++i ) zone_info.F( i, i ) = 0.0;
+	zone_info.Emissivity.dimension( N, 0.9 );
+	zone_info.ScriptF.dimension( N, N, 0.0 );
+
+	// Nothing cached yet
+	EXPECT_FALSE( GetCachedScriptF( 1 ) );
+
+	CalcScriptF( N, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_info.ScriptF );
+	Array2D< Real64 > const ScriptFUnshaded( zone_info.ScriptF );
+	CacheScriptF( 1 );
+
+	// A second shading state
+	zone_info.Emissivity( 2 ) = 0.5;
+	EXPECT_FALSE( GetCachedScriptF( 1 ) );
+	CalcScriptF( N, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_info.ScriptF );
+	Array2D< Real64 > const ScriptFShaded( zone_info.ScriptF );
+	CacheScriptF( 1 );
+	EXPECT_EQ( 2, zone_info.NumScriptFCached );
+
+	// Switching back restores the first state without recalculating
+	zone_info.Emissivity( 2 ) = 0.9;
+	EXPECT_TRUE( GetCachedScriptF( 1 ) );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			EXPECT_DOUBLE_EQ( ScriptFUnshaded( i, j ), zone_info.ScriptF( i, j ) );
+		}
+	}
+
+	zone_info.Emissivity( 2 ) = 0.5;
+	EXPECT_TRUE( GetCachedScriptF( 1 ) );
+	EXPECT_DOUBLE_EQ( ScriptFShaded( 1, 2 ), zone_info.ScriptF( 1, 2 ) );
+
+	// The cache is bounded
+	for ( int state = 1; state <= MaxScriptFCacheStates + 2; ++state ) {
+		zone_info.Emissivity( 3 ) = 0.1 * state;
+		CacheScriptF( 1 );
+	}
+	EXPECT_EQ( MaxScriptFCacheStates, zone_info.NumScriptFCached );
+
+	ZoneInfo.deallocate();
+}
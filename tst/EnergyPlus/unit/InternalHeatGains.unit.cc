@@ -0,0 +1,62 @@
+// EnergyPlus::InternalHeatGains Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/HeatBalanceInternalHeatGains.hh>
+#include <EnergyPlus/InternalHeatGains.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::InternalHeatGains;
+
+TEST( InternalHeatGainsTest, SumAllInternalGains )
+{
+	ShowMessage( "Begin Test: InternalHeatGainsTest, SumAllInternalGains" );
+
+	DataGlobals::NumOfZones = 2;
+	ZoneIntGain.allocate( DataGlobals::NumOfZones );
+
+	// Two devices in zone 1, none in zone 2
+	Real64 PeopleConv( 100.0 ), PeopleRad( 60.0 ), PeopleLat( 40.0 ), PeopleCO2( 1.0e-6 );
+	Real64 LightsConv( 30.0 ), LightsRetAir( 20.0 ), LightsRad( 50.0 );
+	SetupZoneInternalGain( 1, "People", "Occupants", IntGainTypeOf_People, PeopleConv, _, PeopleRad, PeopleLat, _, PeopleCO2 );
+	SetupZoneInternalGain( 1, "Lights", "Lamps", IntGainTypeOf_Lights, LightsConv, LightsRetAir, LightsRad );
+
+	UpdateInternalGainValues();
+
+	Real64 SumGainRate( -1.0 );
+	SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 130.0, SumGainRate );
+	SumAllReturnAirConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 20.0, SumGainRate );
+	SumAllInternalRadiationGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 110.0, SumGainRate );
+	SumAllInternalLatentGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 40.0, SumGainRate );
+	SumAllInternalCO2Gains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 1.0e-6, SumGainRate );
+	SumAllInternalConvectionGains( 2, SumGainRate );
+	EXPECT_DOUBLE_EQ( 0.0, SumGainRate );
+
+	// The sums hold until the device values are stored again, and radiation can be held over
+	PeopleConv = 200.0;
+	LightsRad = 0.0;
+	SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 130.0, SumGainRate );
+	UpdateInternalGainValues( true );
+	SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 230.0, SumGainRate );
+	SumAllInternalRadiationGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 110.0, SumGainRate );
+	UpdateInternalGainValues();
+	SumAllInternalRadiationGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 60.0, SumGainRate );
+
+	ZoneIntGain.deallocate();
+	DataGlobals::NumOfZones = 0;
+}
@@ -0,0 +1,170 @@
+// EnergyPlus::PlantManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/PlantManager.hh>
+#include <EnergyPlus/PlantUtilities.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataPlant;
+using namespace EnergyPlus::PlantManager;
+using namespace EnergyPlus::PlantUtilities;
+
+TEST( PlantManagerTest, SetupPlantLoopGroups )
+{
+	ShowMessage( "Begin Test: PlantManagerTest, SetupPlantLoopGroups" );
+
+	// Three loops: the supply side of loop 3 (condenser) serves the supply side of loop 1 (chiller),
+	// loop 2 is on its own and has a common pipe
+	TotNumLoops = 3;
+	TotNumHalfLoops = 6;
+	PlantLoop.allocate( TotNumLoops );
+	for ( int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+		PlantLoop( LoopNum ).LoopSide.allocate( 2 );
+	}
+	PlantLoop( 2 ).CommonPipeType = CommonPipe_TwoWay;
+	InterConnectTwoPlantLoopSides( 1, SupplySide, 3, DemandSide, TypeOf_Chiller_ElectricEIR, true );
+
+	PlantCallingOrderInfo.allocate( TotNumHalfLoops );
+	PlantCallingOrderInfo( 1 ).LoopIndex = 1;
+	PlantCallingOrderInfo( 1 ).LoopSide = DemandSide;
+	PlantCallingOrderInfo( 2 ).LoopIndex = 2;
+	PlantCallingOrderInfo( 2 ).LoopSide = DemandSide;
+	PlantCallingOrderInfo( 3 ).LoopIndex = 1;
+	PlantCallingOrderInfo( 3 ).LoopSide = SupplySide;
+	PlantCallingOrderInfo( 4 ).LoopIndex = 2;
+	PlantCallingOrderInfo( 4 ).LoopSide = SupplySide;
+	PlantCallingOrderInfo( 5 ).LoopIndex = 3;
+	PlantCallingOrderInfo( 5 ).LoopSide = DemandSide;
+	PlantCallingOrderInfo( 6 ).LoopIndex = 3;
+	PlantCallingOrderInfo( 6 ).LoopSide = SupplySide;
+
+	SetupPlantLoopGroups();
+
+	ASSERT_EQ( 2, NumPlantLoopGroups );
+	ASSERT_EQ( 4u, PlantLoopGroup( 1 ).CallingOrderIndex.size() );
+	EXPECT_EQ( 1, PlantLoopGroup( 1 ).CallingOrderIndex( 1 ) );
+	EXPECT_EQ( 3, PlantLoopGroup( 1 ).CallingOrderIndex( 2 ) );
+	EXPECT_EQ( 5, PlantLoopGroup( 1 ).CallingOrderIndex( 3 ) );
+	EXPECT_EQ( 6, PlantLoopGroup( 1 ).CallingOrderIndex( 4 ) );
+	EXPECT_FALSE( PlantLoopGroup( 1 ).HasCommonPipe );
+	ASSERT_EQ( 2u, PlantLoopGroup( 2 ).CallingOrderIndex.size() );
+	EXPECT_EQ( 2, PlantLoopGroup( 2 ).CallingOrderIndex( 1 ) );
+	EXPECT_EQ( 4, PlantLoopGroup( 2 ).CallingOrderIndex( 2 ) );
+	EXPECT_TRUE( PlantLoopGroup( 2 ).HasCommonPipe );
+
+	// Connecting loop 2 to loop 3 merges all the loops into one group
+	InterConnectTwoPlantLoopSides( 2, SupplySide, 3, DemandSide, TypeOf_Chiller_ElectricEIR, true );
+	SetupPlantLoopGroups();
+
+	ASSERT_EQ( 1, NumPlantLoopGroups );
+	ASSERT_EQ( 6u, PlantLoopGroup( 1 ).CallingOrderIndex.size() );
+	for ( int HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+		EXPECT_EQ( HalfLoopNum, PlantLoopGroup( 1 ).CallingOrderIndex( HalfLoopNum ) );
+	}
+	EXPECT_TRUE( PlantLoopGroup( 1 ).HasCommonPipe );
+
+	NumPlantLoopGroups = 0;
+	PlantLoopGroup.deallocate();
+	PlantCallingOrderInfo.deallocate();
+	PlantLoop.deallocate();
+	TotNumHalfLoops = 0;
+	TotNumLoops = 0;
+}
+
+TEST( PlantManagerTest, SetupPlantLoopGroupsHeatPumpCoupling )
+{
+	ShowMessage( "Begin Test: PlantManagerTest, SetupPlantLoopGroupsHeatPumpCoupling" );
+
+	// A water to water heat pump serves the chilled water loop 1 from its load side on the supply side,
+	// and rejects heat to the condenser loop 2 from its source side on the demand side
+	TotNumLoops = 2;
+	TotNumHalfLoops = 4;
+	PlantLoop.allocate( TotNumLoops );
+	for ( int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+		PlantLoop( LoopNum ).LoopSide.allocate( 2 );
+	}
+	PlantCallingOrderInfo.allocate( TotNumHalfLoops );
+	PlantCallingOrderInfo( 1 ).LoopIndex = 1;
+	PlantCallingOrderInfo( 1 ).LoopSide = DemandSide;
+	PlantCallingOrderInfo( 2 ).LoopIndex = 2;
+	PlantCallingOrderInfo( 2 ).LoopSide = DemandSide;
+	PlantCallingOrderInfo( 3 ).LoopIndex = 1;
+	PlantCallingOrderInfo( 3 ).LoopSide = SupplySide;
+	PlantCallingOrderInfo( 4 ).LoopIndex = 2;
+	PlantCallingOrderInfo( 4 ).LoopSide = SupplySide;
+
+	// Without the interconnect the loops would be iterated apart
+	SetupPlantLoopGroups();
+	EXPECT_EQ( 2, NumPlantLoopGroups );
+
+	// The interconnect registered by the heat pump input routines puts both loops in one group
+	InterConnectTwoPlantLoopSides( 1, SupplySide, 2, DemandSide, TypeOf_HPWaterEFCooling, true );
+	SetupPlantLoopGroups();
+
+	ASSERT_EQ( 1, NumPlantLoopGroups );
+	ASSERT_EQ( 4u, PlantLoopGroup( 1 ).CallingOrderIndex.size() );
+	for ( int HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+		EXPECT_EQ( HalfLoopNum, PlantLoopGroup( 1 ).CallingOrderIndex( HalfLoopNum ) );
+	}
+	EXPECT_TRUE( PlantLoop( 1 ).LoopSide( SupplySide ).Connected( 1 ).LoopDemandsOnRemote );
+	EXPECT_FALSE( PlantLoop( 2 ).LoopSide( DemandSide ).Connected( 1 ).LoopDemandsOnRemote );
+
+	NumPlantLoopGroups = 0;
+	PlantLoopGroup.deallocate();
+	PlantCallingOrderInfo.deallocate();
+	PlantLoop.deallocate();
+	TotNumHalfLoops = 0;
+	TotNumLoops = 0;
+}
+
+TEST( PlantManagerTest, SetupPlantLoopGroupsUserDefinedCoupling )
+{
+	ShowMessage( "Begin Test: PlantManagerTest, SetupPlantLoopGroupsUserDefinedCoupling" );
+
+	// A user defined plant component with three connections: the supply side of loop 1 and the
+	// demand sides of loops 2 and 3
+	TotNumLoops = 3;
+	TotNumHalfLoops = 6;
+	PlantLoop.allocate( TotNumLoops );
+	for ( int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+		PlantLoop( LoopNum ).LoopSide.allocate( 2 );
+	}
+	PlantCallingOrderInfo.allocate( TotNumHalfLoops );
+	for ( int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+		PlantCallingOrderInfo( LoopNum ).LoopIndex = LoopNum;
+		PlantCallingOrderInfo( LoopNum ).LoopSide = DemandSide;
+		PlantCallingOrderInfo( TotNumLoops + LoopNum ).LoopIndex = LoopNum;
+		PlantCallingOrderInfo( TotNumLoops + LoopNum ).LoopSide = SupplySide;
+	}
+
+	// Without the interconnects each loop would be iterated apart
+	SetupPlantLoopGroups();
+	EXPECT_EQ( 3, NumPlantLoopGroups );
+
+	// Every pair of connections is registered by InitPlantUserComponent(), which puts all loops in one group
+	InterConnectTwoPlantLoopSides( 1, SupplySide, 2, DemandSide, TypeOf_PlantComponentUserDefined, true );
+	InterConnectTwoPlantLoopSides( 1, SupplySide, 3, DemandSide, TypeOf_PlantComponentUserDefined, true );
+	InterConnectTwoPlantLoopSides( 2, DemandSide, 3, DemandSide, TypeOf_PlantComponentUserDefined, true );
+	SetupPlantLoopGroups();
+
+	ASSERT_EQ( 1, NumPlantLoopGroups );
+	ASSERT_EQ( 6u, PlantLoopGroup( 1 ).CallingOrderIndex.size() );
+	for ( int HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+		EXPECT_EQ( HalfLoopNum, PlantLoopGroup( 1 ).CallingOrderIndex( HalfLoopNum ) );
+	}
+	EXPECT_EQ( 2, PlantLoop( 1 ).LoopSide( SupplySide ).TotalConnected );
+	EXPECT_EQ( 2, PlantLoop( 2 ).LoopSide( DemandSide ).TotalConnected );
+	EXPECT_EQ( 2, PlantLoop( 3 ).LoopSide( DemandSide ).TotalConnected );
+
+	NumPlantLoopGroups = 0;
+	PlantLoopGroup.deallocate();
+	PlantCallingOrderInfo.deallocate();
+	PlantLoop.deallocate();
+	TotNumHalfLoops = 0;
+	TotNumLoops = 0;
+}
@@ -0,0 +1,104 @@
+// EnergyPlus::ReadVars Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ReadVars.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ReadVars;
+
+namespace {
+
+std::string
+ReadFile( std::string const & FileName )
+{
+	std::ifstream in_stream( FileName );
+	std::stringstream contents;
+	contents << in_stream.rdbuf();
+	return contents.str();
+}
+
+}
+
+TEST( ReadVarsTest, VariableHeading )
+{
+	ShowMessage( "Begin Test: ReadVarsTest, VariableHeading" );
+
+	EXPECT_EQ( "Environment:Site Outdoor Air Drybulb Temperature [C](Hourly)", VariableHeading( "7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Hourly" ) );
+	EXPECT_EQ( "ZONE ONE:Zone Air Temperature [C](Daily)", VariableHeading( "9,7,ZONE ONE,Zone Air Temperature [C] !Daily  [Value,Min,Hour,Minute,Max,Hour,Minute]" ) );
+	EXPECT_EQ( "Electricity:Facility [J](TimeStep)", VariableHeading( "13,1,Electricity:Facility [J] !TimeStep" ) );
+}
+
+TEST( ReadVarsTest, ProcessVariableFile )
+{
+	ShowMessage( "Begin Test: ReadVarsTest, ProcessVariableFile" );
+
+	{
+		std::ofstream eso_stream( "readvars_test.eso" );
+		eso_stream << "Program Version,EnergyPlus\n"
+			"1,5,Environment Title[],Latitude[deg],Longitude[deg],Time Zone[],Elevation[m]\n"
+			"2,8,Day of Simulation[],Month[],Day of Month[],DST Indicator[1=yes 0=no],Hour[],StartMinute[],EndMinute[],DayType\n"
+			"3,5,Cumulative Day of Simulation[],Month[],Day of Month[],DST Indicator[1=yes 0=no],DayType  ! When Daily Report Variables Requested\n"
+			"4,2,Cumulative Days of Simulation[],Month[]  ! When Monthly Report Variables Requested\n"
+			"5,1,Cumulative Days of Simulation[] ! When Run Period Report Variables Requested\n"
+			"7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !TimeStep\n"
+			"8,1,ZONE ONE,Zone Air Temperature [C] !Hourly\n"
+			"9,7,ZONE ONE,Zone Air Temperature Maximum [C] !Daily  [Value,Min,Hour,Minute,Max,Hour,Minute]\n"
+			"End of Data Dictionary\n"
+			" 1,DENVER WINTER,  39.74,-105.18,  -7.00,1793.00\n"
+			" 2,1, 1,21, 0, 1, 0.00,30.00,WinterDesignDay\n"
+			"7,-16.5\n"
+			" 2,1, 1,21, 0, 1,30.00,60.00,WinterDesignDay\n"
+			"7,-16.0\n"
+			"8,18.25\n"
+			" 2,1, 1,21, 0, 2, 0.00,60.00,WinterDesignDay\n"
+			"8,19.5\n"
+			" 3,1, 1,21, 0,WinterDesignDay\n"
+			"9,17.0,16.0, 1,30,21.0, 2,60\n"
+			"End of Data\n";
+	}
+
+	// All variables
+	{
+		std::ofstream rvi_stream( "readvars_test.rvi" );
+		rvi_stream << "readvars_test.eso\nreadvars_test.csv\n";
+	}
+	ProcessVariableFile( "readvars_test.rvi", "readvars_test.audit" );
+	EXPECT_EQ( "Date/Time,Environment:Site Outdoor Air Drybulb Temperature [C](TimeStep),ZONE ONE:Zone Air Temperature [C](Hourly),ZONE ONE:Zone Air Temperature Maximum [C](Daily) \n"
+		" 01/21  00:30:00,-16.5 \n"
+		" 01/21  01:00:00,-16.0,18.25 \n"
+		" 01/21  02:00:00,,19.5,17.0 \n", ReadFile( "readvars_test.csv" ) );
+
+	// Selected variables: a name (exact match only) and a report number, which comes first
+	{
+		std::ofstream rvi_stream( "readvars_test.rvi" );
+		rvi_stream << "readvars_test.eso\nreadvars_test.csv\nZone Air Temperature\n7\n0\n";
+	}
+	ProcessVariableFile( "readvars_test.rvi", "readvars_test.audit" );
+	EXPECT_EQ( "Date/Time,Environment:Site Outdoor Air Drybulb Temperature [C](TimeStep),ZONE ONE:Zone Air Temperature [C](Hourly) \n"
+		" 01/21  00:30:00,-16.5 \n"
+		" 01/21  01:00:00,-16.0,18.25 \n"
+		" 01/21  02:00:00,,19.5 \n", ReadFile( "readvars_test.csv" ) );
+
+	// Names are not case sensitive, and a partial name is used when no name matches exactly
+	{
+		std::ofstream rvi_stream( "readvars_test.rvi" );
+		rvi_stream << "readvars_test.eso\nreadvars_test.csv\n~site outdoor\nzone air temperature max\n0\n";
+	}
+	ProcessVariableFile( "readvars_test.rvi", "readvars_test.audit" );
+	EXPECT_EQ( "Date/Time,ZONE ONE:Zone Air Temperature Maximum [C](Daily) \n"
+		" 01/21  02:00:00,17.0 \n", ReadFile( "readvars_test.csv" ) );
+
+	std::remove( "readvars_test.eso" );
+	std::remove( "readvars_test.rvi" );
+	std::remove( "readvars_test.csv" );
+	std::remove( "readvars_test.audit" );
+}
@@ -0,0 +1,51 @@
+// EnergyPlus::ScheduleManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ScheduleManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ScheduleManager;
+
+TEST( ScheduleManagerTest, ProcessScheduleFileText )
+{
+	ShowMessage( "Begin Test: ScheduleManagerTest, ProcessScheduleFileText" );
+
+	ScheduleFileData FileData;
+
+	// One header row to skip, a short row, an empty field and a field in error
+	ProcessScheduleFileText( "Hour,Lights,Equip\r\n1,0.5,0.25\r\n2,0.75\n3,,x\n4,1.0,2.0", ',', 1, FileData );
+	EXPECT_FALSE( FileData.Unicode );
+	EXPECT_TRUE( FileData.SeparatorFound );
+	EXPECT_EQ( "1,0.5,0.25", FileData.FirstRow );
+	ASSERT_EQ( 5u, FileData.RowStart.size() );
+	EXPECT_EQ( 0u, FileData.RowStart[ 0 ] );
+	EXPECT_EQ( 3u, FileData.RowStart[ 1 ] );
+	EXPECT_EQ( 5u, FileData.RowStart[ 2 ] );
+	EXPECT_EQ( 8u, FileData.RowStart[ 3 ] );
+	EXPECT_EQ( 11u, FileData.RowStart[ 4 ] );
+	EXPECT_DOUBLE_EQ( 0.5, FileData.Values[ 1 ] );
+	EXPECT_DOUBLE_EQ( 0.25, FileData.Values[ 2 ] );
+	EXPECT_DOUBLE_EQ( 0.75, FileData.Values[ 4 ] );
+	EXPECT_DOUBLE_EQ( 0.0, FileData.Values[ 6 ] );
+	EXPECT_TRUE( FileData.ValueErrors[ 6 ] ); // Empty comma separated field
+	EXPECT_DOUBLE_EQ( 0.0, FileData.Values[ 7 ] );
+	EXPECT_TRUE( FileData.ValueErrors[ 7 ] );
+	EXPECT_DOUBLE_EQ( 2.0, FileData.Values[ 10 ] );
+	EXPECT_FALSE( FileData.ValueErrors[ 10 ] );
+
+	// Tab separated, nothing skipped
+	ProcessScheduleFileText( "10\t20\n30\t40\n", '\t', 0, FileData );
+	ASSERT_EQ( 3u, FileData.RowStart.size() );
+	EXPECT_EQ( 4u, FileData.Values.size() );
+	EXPECT_DOUBLE_EQ( 40.0, FileData.Values[ FileData.RowStart[ 1 ] + 1 ] );
+
+	// Single column without the separator
+	ProcessScheduleFileText( "1.5\n2.5\n", ',', 0, FileData );
+	EXPECT_FALSE( FileData.SeparatorFound );
+	EXPECT_EQ( 2u, FileData.Values.size() );
+	EXPECT_DOUBLE_EQ( 2.5, FileData.Values[ 1 ] );
+}
@@ -0,0 +1,113 @@
+// EnergyPlus::WindowEquivalentLayer Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+#include <EnergyPlus/WindowEquivalentLayer.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataGlobals;
+using namespace EnergyPlus::WindowEquivalentLayer;
+
+TEST( WindowEquivalentLayerTest, VBOffNormalPropertyTable )
+{
+	ShowMessage( "Begin Test: WindowEquivalentLayerTest, VBOffNormalPropertyTable" );
+
+	// horizontal venetian blind with fixed 45 deg slats
+	CFSLAYER L;
+	L.LTYPE = ltyVBHOR;
+	L.S = 0.0125;
+	L.W = 0.016;
+	L.PHI_DEG = 45.0;
+	L.CNTRL = lscNONE;
+	L.SWP_MAT.RHOSFDD = 0.7;
+	L.SWP_MAT.RHOSBDD = 0.6;
+	FinalizeCFSLAYER( L );
+
+	Real64 MaxTblErr;
+	Real64 MaxTblErrX1;
+	Real64 MaxTblErrX2;
+	SetupOffNormalPropertyTable( L, MaxTblErr, MaxTblErrX1, MaxTblErrX2 );
+	ASSERT_EQ( 181, L.SWP_TBL.isize1() );
+	ASSERT_EQ( 1, L.SWP_TBL.isize2() );
+	EXPECT_LT( MaxTblErr, 0.02 );
+	EXPECT_DOUBLE_EQ( 45.0, MaxTblErrX2 );
+
+	// table points return the directly evaluated properties
+	CFSSWP SWPX;
+	CFSSWP SWPI;
+	VB_SWP( L, SWPX, 30.0 * DegToRadians );
+	InterpOffNormalProperties( L, 30.0, L.PHI_DEG, SWPI );
+	EXPECT_DOUBLE_EQ( SWPX.TAUSFBB, SWPI.TAUSFBB );
+	EXPECT_DOUBLE_EQ( SWPX.TAUSBBB, SWPI.TAUSBBB );
+	EXPECT_DOUBLE_EQ( SWPX.TAUSFBD, SWPI.TAUSFBD );
+	EXPECT_DOUBLE_EQ( SWPX.TAUSBBD, SWPI.TAUSBBD );
+	EXPECT_DOUBLE_EQ( SWPX.RHOSFBD, SWPI.RHOSFBD );
+	EXPECT_DOUBLE_EQ( SWPX.RHOSBBD, SWPI.RHOSBBD );
+
+	// between table points the error is within the reported bound
+	VB_SWP( L, SWPX, -32.5 * DegToRadians );
+	InterpOffNormalProperties( L, -32.5, L.PHI_DEG, SWPI );
+	EXPECT_NEAR( SWPX.TAUSFBB, SWPI.TAUSFBB, MaxTblErr );
+	EXPECT_NEAR( SWPX.TAUSFBD, SWPI.TAUSFBD, MaxTblErr );
+	EXPECT_NEAR( SWPX.RHOSFBD, SWPI.RHOSFBD, MaxTblErr );
+	EXPECT_NEAR( 0.67158, SWPI.TAUSFBB, 0.00001 );
+
+	// a controlled blind is tabulated over the slat angle too
+	L.CNTRL = lscVBPROF;
+	SetupOffNormalPropertyTable( L, MaxTblErr, MaxTblErrX1, MaxTblErrX2 );
+	ASSERT_EQ( 181, L.SWP_TBL.isize1() );
+	ASSERT_EQ( 91, L.SWP_TBL.isize2() );
+	L.PHI_DEG = -30.0;
+	VB_SWP( L, SWPX, 30.0 * DegToRadians );
+	InterpOffNormalProperties( L, 30.0, L.PHI_DEG, SWPI );
+	EXPECT_DOUBLE_EQ( SWPX.TAUSFBB, SWPI.TAUSFBB );
+	EXPECT_DOUBLE_EQ( SWPX.RHOSBBD, SWPI.RHOSBBD );
+
+	// glazing layers are not tabulated
+	CFSLAYER G;
+	G.LTYPE = ltyGLAZE;
+	SetupOffNormalPropertyTable( G, MaxTblErr, MaxTblErrX1, MaxTblErrX2 );
+	EXPECT_EQ( 0u, G.SWP_TBL.size() );
+	EXPECT_EQ( 0.0, MaxTblErr );
+}
+
+TEST( WindowEquivalentLayerTest, PDOffNormalPropertyTable )
+{
+	ShowMessage( "Begin Test: WindowEquivalentLayerTest, PDOffNormalPropertyTable" );
+
+	CFSLAYER L;
+	L.LTYPE = ltyDRAPE;
+	L.S = 0.0762;
+	L.W = 0.0762;
+	L.SWP_MAT.RHOSFBD = 0.5;
+	L.SWP_MAT.RHOSBBD = 0.5;
+	L.SWP_MAT.TAUSFBB = 0.1;
+	L.SWP_MAT.TAUSBBB = 0.1;
+	L.SWP_MAT.TAUSFBD = 0.15;
+	L.SWP_MAT.TAUSBBD = 0.15;
+	L.SWP_MAT.RHOSFDD = 0.5;
+	L.SWP_MAT.RHOSBDD = 0.5;
+	L.SWP_MAT.TAUS_DD = 0.2;
+	FinalizeCFSLAYER( L );
+
+	Real64 MaxTblErr;
+	Real64 MaxTblErrX1;
+	Real64 MaxTblErrX2;
+	SetupOffNormalPropertyTable( L, MaxTblErr, MaxTblErrX1, MaxTblErrX2 );
+	ASSERT_EQ( 91, L.SWP_TBL.isize1() );
+	ASSERT_EQ( 91, L.SWP_TBL.isize2() );
+	EXPECT_LT( MaxTblErr, 0.005 );
+
+	// the properties are symmetric in the profile angles
+	CFSSWP SWPX;
+	CFSSWP SWPI;
+	PD_SWP( L, SWPX, 20.5 * DegToRadians, -40.5 * DegToRadians );
+	InterpOffNormalProperties( L, 20.5, 40.5, SWPI );
+	EXPECT_NEAR( SWPX.TAUSFBB, SWPI.TAUSFBB, MaxTblErr );
+	EXPECT_NEAR( SWPX.TAUSBBD, SWPI.TAUSBBD, MaxTblErr );
+	EXPECT_NEAR( SWPX.RHOSFBD, SWPI.RHOSFBD, MaxTblErr );
+}
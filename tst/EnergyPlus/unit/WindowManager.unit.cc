@@ -0,0 +1,61 @@
+// EnergyPlus::WindowManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/UtilityRoutines.hh>
+#include <EnergyPlus/WindowManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowManager;
+
+TEST( WindowManagerTest, WindowGasMixtureProperties )
+{
+	ShowMessage( "Begin Test: WindowManagerTest, WindowGasMixtureProperties" );
+
+	// 12.7 mm gap filled with 10% air and 90% argon
+	gap( 1 ) = 0.0127;
+	gnmix( 1 ) = 2;
+	gwght( 1, 1 ) = 28.97;
+	gwght( 2, 1 ) = 39.948;
+	gfract( 1, 1 ) = 0.1;
+	gfract( 2, 1 ) = 0.9;
+	gcon( 1, 1, 1 ) = 2.873e-3;
+	gcon( 2, 1, 1 ) = 7.760e-5;
+	gcon( 1, 2, 1 ) = 2.285e-3;
+	gcon( 2, 2, 1 ) = 5.149e-5;
+	gvis( 1, 1, 1 ) = 3.723e-6;
+	gvis( 2, 1, 1 ) = 4.940e-8;
+	gvis( 1, 2, 1 ) = 3.379e-6;
+	gvis( 2, 2, 1 ) = 6.451e-8;
+	gcp( 1, 1, 1 ) = 1002.737;
+	gcp( 2, 1, 1 ) = 1.2324e-2;
+	gcp( 1, 2, 1 ) = 521.929;
+	WindowGasMixtureFactors( 1 );
+
+	Real64 con;
+	Real64 pr;
+	Real64 gr;
+	WindowGasConductance( 285.0, 275.0, 1, con, pr, gr );
+	EXPECT_NEAR( 0.0174321498, con, 1.0e-10 );
+	EXPECT_NEAR( 0.6752941514, pr, 1.0e-9 );
+	EXPECT_NEAR( 4489.813926, gr, 1.0e-5 );
+
+	Real64 dens;
+	Real64 visc;
+	WindowGasPropertiesAtTemp( 280.0, 1, dens, visc );
+	EXPECT_NEAR( 1.668778007, dens, 1.0e-8 );
+	EXPECT_NEAR( 2.109497668e-5, visc, 1.0e-14 );
+
+	gap = 0.0;
+	gnmix = 0;
+	gwght = 0.0;
+	gfract = 0.0;
+	gcon = 0.0;
+	gvis = 0.0;
+	gcp = 0.0;
+	gwghtroot4 = 0.0;
+	gdowner = 0.0;
+	gpsiterm = 0.0;
+}
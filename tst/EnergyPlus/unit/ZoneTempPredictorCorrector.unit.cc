@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataConvergParams.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataHeatBalFanSys.hh>
 #include <EnergyPlus/DataZoneEquipment.hh>
@@ -16,6 +17,10 @@
 #include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataAirflowNetwork.hh>
+#include <EnergyPlus/DataRoomAirModel.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/DataZoneControls.hh>
+#include <EnergyPlus/DataZoneEnergyDemands.hh>
 #include <EnergyPlus/Psychrometrics.hh>
 
 using namespace EnergyPlus;
@@ -32,6 +37,8 @@ using namespace EnergyPlus::DataHVACGlobals;
 using namespace EnergyPlus::DataSurfaces;
 using namespace EnergyPlus::DataEnvironment;
 using namespace EnergyPlus::DataAirflowNetwork;
+using namespace EnergyPlus::DataRoomAirModel;
+using namespace EnergyPlus::DataZoneEnergyDemands;
 using namespace EnergyPlus::Psychrometrics;
 
 
@@ -229,3 +236,322 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	ZoneW1.deallocate();
 
 }
+
+TEST( ZoneTempPredictorCorrector, CalcZoneSumsAllZonesTest )
+{
+	ShowMessage( "Begin Test: ZoneTempPredictorCorrector, CalcZoneSumsAllZonesTest" );
+
+	clear_state();
+	NumOfZones = 3;
+	Zone.allocate( NumOfZones );
+	ZoneIntGain.allocate( NumOfZones );
+	AirModel.allocate( NumOfZones ); // Well-mixed by default
+	ZoneSums.allocate( NumOfZones );
+	ZoneAirHumRat.dimension( NumOfZones, 0.008 );
+	SumConvHTRadSys.dimension( NumOfZones, 0.0 );
+	SumConvPool.dimension( NumOfZones, 0.0 );
+	MCPI.dimension( NumOfZones, 0.0 );
+	MCPV.dimension( NumOfZones, 0.0 );
+	MCPM.dimension( NumOfZones, 0.0 );
+	MCPE.dimension( NumOfZones, 0.0 );
+	MCPC.dimension( NumOfZones, 0.0 );
+	MCPTI.dimension( NumOfZones, 0.0 );
+	MCPTV.dimension( NumOfZones, 0.0 );
+	MCPTM.dimension( NumOfZones, 0.0 );
+	MCPTE.dimension( NumOfZones, 0.0 );
+	MCPTC.dimension( NumOfZones, 0.0 );
+	MDotCPOA.dimension( NumOfZones, 0.0 );
+	SimulateAirflowNetwork = 0;
+	NumZoneReturnPlenums = 0;
+	NumZoneSupplyPlenums = 0;
+	std::vector< int > controlledZoneEquipConfigNums;
+
+	for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		Zone( ZoneNum ).SurfaceFirst = 1; // No surfaces
+		Zone( ZoneNum ).SurfaceLast = 0;
+		Zone( ZoneNum ).OutDryBulbTemp = 10.0 + ZoneNum;
+		SumConvHTRadSys( ZoneNum ) = 100.0 * ZoneNum;
+		SumConvPool( ZoneNum ) = 5.0;
+		MCPI( ZoneNum ) = 1.5 * ZoneNum;
+		MCPTI( ZoneNum ) = 15.0 * ZoneNum;
+		MCPM( ZoneNum ) = 0.5 * ZoneNum; // Mixing from other zones, already gathered for this zone
+		MCPTM( ZoneNum ) = 11.0 * ZoneNum;
+		MDotCPOA( ZoneNum ) = 0.25;
+	}
+
+	// Single thread: the sums are left to the zone loops
+	DataSystemVariables::NumberZoneAirThreads = 1;
+	EXPECT_FALSE( CalcZoneSumsAllZones( controlledZoneEquipConfigNums ) );
+
+	DataSystemVariables::NumberZoneAirThreads = 2;
+	EXPECT_TRUE( CalcZoneSumsAllZones( controlledZoneEquipConfigNums ) );
+	for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		Real64 SumIntGain( 0.0 ), SumHA( 0.0 ), SumHATsurf( 0.0 ), SumHATref( 0.0 ), SumMCp( 0.0 ), SumMCpT( 0.0 ), SumSysMCp( 0.0 ), SumSysMCpT( 0.0 );
+		CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+		EXPECT_EQ( SumIntGain, ZoneSums( ZoneNum ).SumIntGain );
+		EXPECT_EQ( SumHA, ZoneSums( ZoneNum ).SumHA );
+		EXPECT_EQ( SumHATsurf, ZoneSums( ZoneNum ).SumHATsurf );
+		EXPECT_EQ( SumHATref, ZoneSums( ZoneNum ).SumHATref );
+		EXPECT_EQ( SumMCp, ZoneSums( ZoneNum ).SumMCp );
+		EXPECT_EQ( SumMCpT, ZoneSums( ZoneNum ).SumMCpT );
+		EXPECT_EQ( SumSysMCp, ZoneSums( ZoneNum ).SumSysMCp );
+		EXPECT_EQ( SumSysMCpT, ZoneSums( ZoneNum ).SumSysMCpT );
+	}
+	EXPECT_DOUBLE_EQ( 205.0, ZoneSums( 2 ).SumIntGain );
+	EXPECT_DOUBLE_EQ( 3.0 + 1.0 + 0.25, ZoneSums( 2 ).SumMCp );
+	EXPECT_DOUBLE_EQ( 30.0 + 22.0 + 0.25 * 12.0, ZoneSums( 2 ).SumMCpT );
+
+	// Deallocate everything
+	DataSystemVariables::NumberZoneAirThreads = 1;
+	NumOfZones = 0;
+	Zone.deallocate();
+	ZoneIntGain.deallocate();
+	AirModel.deallocate();
+	clear_state();
+	ZoneAirHumRat.deallocate();
+	SumConvHTRadSys.deallocate();
+	SumConvPool.deallocate();
+	MCPI.deallocate();
+	MCPV.deallocate();
+	MCPM.deallocate();
+	MCPE.deallocate();
+	MCPC.deallocate();
+	MCPTI.deallocate();
+	MCPTV.deallocate();
+	MCPTM.deallocate();
+	MCPTE.deallocate();
+	MCPTC.deallocate();
+	MDotCPOA.deallocate();
+
+}
+
+TEST( ZoneTempPredictorCorrector, PredictSystemLoadsShortenTimeStepTest )
+{
+	ShowMessage( "Begin Test: ZoneTempPredictorCorrector, PredictSystemLoadsShortenTimeStepTest" );
+
+	InitializePsychRoutines();
+
+	// Three controlled zones, each with a zone node and an inlet node and a heating setpoint
+	NumOfZones = 3;
+	Zone.allocate( NumOfZones );
+	ZoneEquipConfig.allocate( NumOfZones );
+	Node.allocate( 2 * NumOfZones );
+	ZoneIntGain.allocate( NumOfZones );
+	AirModel.allocate( NumOfZones ); // Well-mixed by default
+	IsZoneDV.dimension( NumOfZones, false );
+	IsZoneUI.dimension( NumOfZones, false );
+	ZoneSums.allocate( NumOfZones );
+	ZoneSysEnergyDemand.allocate( NumOfZones );
+	ZoneSysMoistureDemand.allocate( NumOfZones );
+	for ( auto * a : { &MAT, &ZoneAirHumRat, &XMAT, &XM2T, &XM3T, &XM4T, &DSXMAT, &DSXM2T, &DSXM3T, &DSXM4T, &WZoneTimeMinus1, &WZoneTimeMinus2, &WZoneTimeMinus3, &WZoneTimeMinus4, &DSWZoneTimeMinus1, &DSWZoneTimeMinus2, &DSWZoneTimeMinus3, &DSWZoneTimeMinus4, &ZTM1, &ZTM2, &ZTM3, &WZoneTimeMinus1Temp, &WZoneTimeMinus2Temp, &WZoneTimeMinus3Temp, &TempTstatAir, &AIRRAT, &SysDepZoneLoadsLagged, &TempDepZnLd, &TempIndZnLd, &TempZoneThermostatSetPoint, &ZoneSetPointLast, &SNLoadPredictedRate, &SNLoadPredictedHSPRate, &SNLoadPredictedCSPRate, &MoisturePredictedRate, &SumConvHTRadSys, &SumConvPool, &MCPI, &MCPV, &MCPM, &MCPE, &MCPC, &MCPTI, &MCPTV, &MCPTM, &MCPTE, &MCPTC, &MDotCPOA } ) {
+		a->dimension( NumOfZones, 0.0 );
+	}
+	LoadCorrectionFactor.dimension( NumOfZones, 1.0 );
+	TempControlType.dimension( NumOfZones, SingleHeatingSetPoint );
+	DeadBandOrSetback.dimension( NumOfZones, false );
+	CurDeadBandOrSetback.dimension( NumOfZones, false );
+	Setback.dimension( NumOfZones, false );
+	NumStageCtrZone = 0;
+	DataZoneControls::NumHumidityControlZones = 0;
+	SimulateAirflowNetwork = 0;
+	NumZoneReturnPlenums = 0;
+	NumZoneSupplyPlenums = 0;
+	ZoneAirSolutionAlgo = Use3rdOrder;
+	ZoneVolCapMultpSens = 1.0;
+	OutBaroPress = 101325.0;
+	std::vector< int > controlledZoneEquipConfigNums;
+	for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		Zone( ZoneNum ).IsControlled = true;
+		Zone( ZoneNum ).Volume = 300.0;
+		Zone( ZoneNum ).SurfaceFirst = 1; // No surfaces
+		Zone( ZoneNum ).SurfaceLast = 0;
+		Zone( ZoneNum ).SystemZoneNodeNumber = ZoneNum;
+		ZoneEquipConfig( ZoneNum ).ActualZoneNum = ZoneNum;
+		ZoneEquipConfig( ZoneNum ).NumInletNodes = 1;
+		ZoneEquipConfig( ZoneNum ).InletNode.dimension( 1, NumOfZones + ZoneNum );
+		Node( NumOfZones + ZoneNum ).Temp = 30.0 + ZoneNum;
+		Node( NumOfZones + ZoneNum ).MassFlowRate = 0.2 * ZoneNum;
+		SumConvHTRadSys( ZoneNum ) = 100.0 * ZoneNum;
+		MCPI( ZoneNum ) = 1.5 * ZoneNum;
+		MCPTI( ZoneNum ) = 15.0 * ZoneNum;
+		TempZoneThermostatSetPoint( ZoneNum ) = 21.0;
+		controlledZoneEquipConfigNums.push_back( ZoneNum );
+	}
+
+	// The system timestep is being halved after the corrector ran with the full zone timestep, so
+	// MAT, ZoneAirHumRat and the zone node hold corrector results that the predictor rolls back
+	TimeStepSys = 0.125;
+	NumOfSysTimeSteps = 2;
+	NumOfSysTimeStepsLastZoneTimeStep = 1;
+	auto const SetHistories = []() {
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			MAT( ZoneNum ) = 24.0 + ZoneNum;
+			ZoneAirHumRat( ZoneNum ) = 0.012;
+			XMAT( ZoneNum ) = 20.0 + ZoneNum;
+			XM2T( ZoneNum ) = 19.5 + ZoneNum;
+			XM3T( ZoneNum ) = 19.0 + ZoneNum;
+			XM4T( ZoneNum ) = 18.5 + ZoneNum;
+			WZoneTimeMinus1( ZoneNum ) = 0.004 + 0.001 * ZoneNum;
+			WZoneTimeMinus2( ZoneNum ) = 0.004;
+			WZoneTimeMinus3( ZoneNum ) = 0.004;
+			WZoneTimeMinus4( ZoneNum ) = 0.004;
+			Node( ZoneNum ).Temp = MAT( ZoneNum );
+			Node( ZoneNum ).HumRat = ZoneAirHumRat( ZoneNum );
+		}
+	};
+
+	// Zone by zone heat balance sums
+	DataSystemVariables::NumberZoneAirThreads = 1;
+	clear_state();
+	ZoneSums.allocate( NumOfZones );
+	SetHistories();
+	PredictSystemLoads( true, false, 0.25 );
+	Array1D< ZoneSumsData > const SerialZoneSums( ZoneSums );
+	Array1D< Real64 > const SerialTempDepZnLd( TempDepZnLd );
+	Array1D< Real64 > const SerialTempIndZnLd( TempIndZnLd );
+	Array1D< Real64 > const SerialLoadToHeatingSetPoint( SNLoadPredictedHSPRate );
+
+	// The sums use the rolled back zone air humidity ratio
+	for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		EXPECT_EQ( WZoneTimeMinus1( ZoneNum ), ZoneAirHumRat( ZoneNum ) );
+		EXPECT_DOUBLE_EQ( 0.2 * ZoneNum * PsyCpAirFnWTdb( WZoneTimeMinus1( ZoneNum ), 30.0 + ZoneNum ), SerialZoneSums( ZoneNum ).SumSysMCp );
+	}
+
+	// Heat balance sums of all zones ahead of the zone loop give the same results
+	DataSystemVariables::NumberZoneAirThreads = 2;
+	clear_state();
+	ZoneSums.allocate( NumOfZones );
+	SetHistories();
+	PredictSystemLoads( true, false, 0.25 );
+	for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumIntGain, ZoneSums( ZoneNum ).SumIntGain );
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumHA, ZoneSums( ZoneNum ).SumHA );
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumHATsurf, ZoneSums( ZoneNum ).SumHATsurf );
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumHATref, ZoneSums( ZoneNum ).SumHATref );
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumMCp, ZoneSums( ZoneNum ).SumMCp );
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumMCpT, ZoneSums( ZoneNum ).SumMCpT );
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumSysMCp, ZoneSums( ZoneNum ).SumSysMCp );
+		EXPECT_EQ( SerialZoneSums( ZoneNum ).SumSysMCpT, ZoneSums( ZoneNum ).SumSysMCpT );
+		EXPECT_EQ( SerialTempDepZnLd( ZoneNum ), TempDepZnLd( ZoneNum ) );
+		EXPECT_EQ( SerialTempIndZnLd( ZoneNum ), TempIndZnLd( ZoneNum ) );
+		EXPECT_EQ( SerialLoadToHeatingSetPoint( ZoneNum ), SNLoadPredictedHSPRate( ZoneNum ) );
+	}
+
+	// Deallocate everything
+	DataSystemVariables::NumberZoneAirThreads = 1;
+	clear_state();
+	NumOfZones = 0;
+	Zone.deallocate();
+	ZoneEquipConfig.deallocate();
+	Node.deallocate();
+	ZoneIntGain.deallocate();
+	AirModel.deallocate();
+	IsZoneDV.deallocate();
+	IsZoneUI.deallocate();
+	ZoneSysEnergyDemand.deallocate();
+	ZoneSysMoistureDemand.deallocate();
+	for ( auto * a : { &MAT, &ZoneAirHumRat, &XMAT, &XM2T, &XM3T, &XM4T, &DSXMAT, &DSXM2T, &DSXM3T, &DSXM4T, &WZoneTimeMinus1, &WZoneTimeMinus2, &WZoneTimeMinus3, &WZoneTimeMinus4, &DSWZoneTimeMinus1, &DSWZoneTimeMinus2, &DSWZoneTimeMinus3, &DSWZoneTimeMinus4, &ZTM1, &ZTM2, &ZTM3, &WZoneTimeMinus1Temp, &WZoneTimeMinus2Temp, &WZoneTimeMinus3Temp, &TempTstatAir, &AIRRAT, &SysDepZoneLoadsLagged, &TempDepZnLd, &TempIndZnLd, &TempZoneThermostatSetPoint, &ZoneSetPointLast, &SNLoadPredictedRate, &SNLoadPredictedHSPRate, &SNLoadPredictedCSPRate, &MoisturePredictedRate, &SumConvHTRadSys, &SumConvPool, &MCPI, &MCPV, &MCPM, &MCPE, &MCPC, &MCPTI, &MCPTV, &MCPTM, &MCPTE, &MCPTC, &MDotCPOA } ) {
+		a->deallocate();
+	}
+	LoadCorrectionFactor.deallocate();
+	TempControlType.deallocate();
+	DeadBandOrSetback.deallocate();
+	CurDeadBandOrSetback.deallocate();
+	Setback.deallocate();
+
+}
+
+TEST( ZoneTempPredictorCorrector, NumSysTimeStepsForTruncationErrorTest )
+{
+
+	Real64 const SaveMaxZoneTempError( DataConvergParams::MaxZoneTempError );
+	int const SaveLimitNumSysSteps( LimitNumSysSteps );
+	int const SaveZoneAirSolutionAlgo( ZoneAirSolutionAlgo );
+	DataConvergParams::MaxZoneTempError = 0.05;
+	LimitNumSysSteps = 10;
+
+	// Third order backward difference, error estimate reduced by the cube of the number of steps
+	ZoneAirSolutionAlgo = Use3rdOrder;
+	EXPECT_EQ( 1, NumSysTimeStepsForTruncationError( 0.0 ) );
+	EXPECT_EQ( 1, NumSysTimeStepsForTruncationError( 0.05 ) );
+	EXPECT_EQ( 2, NumSysTimeStepsForTruncationError( 0.06 ) );
+	EXPECT_EQ( 3, NumSysTimeStepsForTruncationError( 0.5 ) ); // ( 0.5 / 0.05 )^( 1/3 ) = 2.15
+	EXPECT_EQ( 10, NumSysTimeStepsForTruncationError( 100.0 ) ); // limited by LimitNumSysSteps
+
+	// First order methods, error estimate reduced by the square of the number of steps
+	ZoneAirSolutionAlgo = UseEulerMethod;
+	EXPECT_EQ( 1, NumSysTimeStepsForTruncationError( 0.04 ) );
+	EXPECT_EQ( 4, NumSysTimeStepsForTruncationError( 0.5 ) ); // ( 0.5 / 0.05 )^( 1/2 ) = 3.16
+
+	// Minimum system timestep equal to the zone timestep
+	LimitNumSysSteps = 1;
+	EXPECT_EQ( 1, NumSysTimeStepsForTruncationError( 0.5 ) );
+
+	DataConvergParams::MaxZoneTempError = SaveMaxZoneTempError;
+	LimitNumSysSteps = SaveLimitNumSysSteps;
+	ZoneAirSolutionAlgo = SaveZoneAirSolutionAlgo;
+
+}
+
+TEST( ZoneTempPredictorCorrector, ZoneTempTruncationErrorTest )
+{
+
+	int const SaveZoneAirSolutionAlgo( ZoneAirSolutionAlgo );
+	ZT.allocate( 2 );
+	ZTM1.allocate( 2 );
+	ZTM2.allocate( 2 );
+	ZTM3.allocate( 2 );
+
+	// Linear drift of 0.3 C per timestep in zone 1 and a steady zone 2: no truncation error
+	ZTM3( 1 ) = 20.0;
+	ZTM2( 1 ) = 20.3;
+	ZTM1( 1 ) = 20.6;
+	ZT( 1 ) = 20.9;
+	ZTM3( 2 ) = 22.0;
+	ZTM2( 2 ) = 22.0;
+	ZTM1( 2 ) = 22.0;
+	ZT( 2 ) = 22.0;
+	ZoneAirSolutionAlgo = Use3rdOrder;
+	ZoneTempTruncationError = 0.0;
+	UpdateZoneTempTruncationError( 1 );
+	UpdateZoneTempTruncationError( 2 );
+	EXPECT_NEAR( 0.0, ZoneTempTruncationError, 1.0e-12 );
+	ZoneAirSolutionAlgo = UseEulerMethod;
+	ZoneTempTruncationError = 0.0;
+	UpdateZoneTempTruncationError( 1 );
+	UpdateZoneTempTruncationError( 2 );
+	EXPECT_NEAR( 0.0, ZoneTempTruncationError, 1.0e-12 );
+
+	// Step change of 2 C in zone 2 in the last timestep: the largest zone error is kept
+	ZT( 2 ) = 24.0;
+	ZoneAirSolutionAlgo = Use3rdOrder;
+	ZoneTempTruncationError = 0.0;
+	UpdateZoneTempTruncationError( 1 );
+	UpdateZoneTempTruncationError( 2 );
+	EXPECT_NEAR( 2.0, ZoneTempTruncationError, 1.0e-12 );
+	ZoneAirSolutionAlgo = UseEulerMethod;
+	ZoneTempTruncationError = 0.0;
+	UpdateZoneTempTruncationError( 2 );
+	UpdateZoneTempTruncationError( 1 );
+	EXPECT_NEAR( 1.0, ZoneTempTruncationError, 1.0e-12 );
+
+	// Step change that has passed: the first order estimate only sees the last two steps
+	ZTM2( 2 ) = 22.0;
+	ZTM1( 2 ) = 24.0;
+	ZT( 2 ) = 24.0;
+	ZoneTempTruncationError = 0.0;
+	UpdateZoneTempTruncationError( 2 );
+	EXPECT_NEAR( 1.0, ZoneTempTruncationError, 1.0e-12 );
+	ZoneAirSolutionAlgo = Use3rdOrder;
+	ZoneTempTruncationError = 0.0;
+	UpdateZoneTempTruncationError( 2 );
+	EXPECT_NEAR( 4.0, ZoneTempTruncationError, 1.0e-12 ); // | 24 - ( 3 * 24 - 3 * 22 + 22 ) |
+
+	ZoneAirSolutionAlgo = SaveZoneAirSolutionAlgo;
+	ZoneTempTruncationError = 0.0;
+	ZT.deallocate();
+	ZTM1.deallocate();
+	ZTM2.deallocate();
+	ZTM3.deallocate();
+
+}